@@ -0,0 +1,69 @@
+#include "aqi.h"
+
+#define AQI_BANDS 6
+
+// Index value at each breakpoint; band i spans aqiNodes[i]..aqiNodes[i+1]
+static const int16_t aqiNodes[AQI_BANDS + 1] = { 0, 50, 100, 200, 300, 400, 500 };
+
+// Concentration breakpoints in 0.1 µg/m³. The last node of each row is where
+// the "Severe" band reaches 500; above it the index is clamped.
+static const int32_t breakpoints[AQI_POLLUTANT_COUNT][AQI_BANDS + 1] = {
+    /* PM2.5 */ { 0,   300,   600,    900,   1200,   2500,   3800 },
+    /* PM10  */ { 0,   500,  1000,   2500,   3500,   4300,   5100 },
+    /* NO2   */ { 0,   400,   800,   1800,   2800,   4000,   5200 },
+    /* O3    */ { 0,   500,  1000,   1680,   2080,   7480,  12880 },
+    /* SO2   */ { 0,   400,   800,   3800,   8000,  16000,  24000 },
+    /* CO    */ { 0, 10000, 20000, 100000, 170000, 340000, 510000 },
+};
+
+static const char* const names[AQI_POLLUTANT_COUNT] = { "PM2.5", "PM10", "NO2", "O3", "SO2", "CO" };
+
+// ─── Public ─────────────────────────────────────────────────
+int32_t aqi_conc(float ugm3) {
+    if (isnan(ugm3) || ugm3 < 0) return AQI_MISSING;
+    return (int32_t)(ugm3 * 10.0f + 0.5f);
+}
+
+int16_t aqi_sub_index(AqiPollutant p, int32_t conc) {
+    if (conc < 0) return AQI_MISSING;
+    const int32_t* bp = breakpoints[p];
+    if (conc >= bp[AQI_BANDS]) return AQI_MAX;
+    int band = 0;
+    while (conc > bp[band + 1]) band++;
+    int32_t span  = bp[band + 1] - bp[band];
+    int32_t range = aqiNodes[band + 1] - aqiNodes[band];
+    return (int16_t)(aqiNodes[band] + ((conc - bp[band]) * range + span / 2) / span);
+}
+
+AqiResult aqi_compute(const int32_t conc[AQI_POLLUTANT_COUNT]) {
+    AqiResult r;
+    r.aqi      = AQI_MISSING;
+    r.dominant = AQI_PM25;
+    int count  = 0;
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++) {
+        r.sub[p] = aqi_sub_index((AqiPollutant)p, conc[p]);
+        if (r.sub[p] == AQI_MISSING) continue;
+        count++;
+        if (r.sub[p] > r.aqi) {
+            r.aqi      = r.sub[p];
+            r.dominant = p;
+        }
+    }
+    bool hasPm = r.sub[AQI_PM25] != AQI_MISSING || r.sub[AQI_PM10] != AQI_MISSING;
+    r.valid = count >= 3 && hasPm;
+    return r;
+}
+
+const char* aqi_pollutant_name(uint8_t p) {
+    return p < AQI_POLLUTANT_COUNT ? names[p] : "?";
+}
+
+const char* aqi_category(int aqi) {
+    if (aqi < 0)    return "--";
+    if (aqi <= 50)  return "Good";
+    if (aqi <= 100) return "Satisfactory";
+    if (aqi <= 200) return "Moderate";
+    if (aqi <= 300) return "Poor";
+    if (aqi <= 400) return "Very Poor";
+    return "Severe";
+}
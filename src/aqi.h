@@ -0,0 +1,35 @@
+#pragma once
+#include <Arduino.h>
+
+// ─── India AQI (CPCB) ───────────────────────────────────────
+// Table-driven sub-index calculation using integer interpolation between
+// CPCB breakpoints. Concentrations are passed in 0.1 µg/m³ units for every
+// pollutant (CO too — the mg/m³ breakpoints are stored scaled). weatherapi.com
+// only reports instantaneous values, so they stand in for the 24 h / 8 h
+// averages the official index uses.
+enum AqiPollutant {
+    AQI_PM25 = 0,
+    AQI_PM10 = 1,
+    AQI_NO2  = 2,
+    AQI_O3   = 3,
+    AQI_SO2  = 4,
+    AQI_CO   = 5,
+    AQI_POLLUTANT_COUNT = 6
+};
+
+#define AQI_MISSING  -1
+#define AQI_MAX      500
+
+struct AqiResult {
+    int16_t aqi;                         // max sub-index, AQI_MISSING if nothing was available
+    int16_t sub[AQI_POLLUTANT_COUNT];    // AQI_MISSING for pollutants not reported
+    uint8_t dominant;                    // AqiPollutant with the highest sub-index
+    bool    valid;                       // CPCB rule: ≥3 pollutants, one of them PM2.5 or PM10
+};
+
+// ─── Public API ─────────────────────────────────────────────
+int32_t     aqi_conc(float ugm3);                                   // µg/m³ → 0.1 µg/m³, <0 stays missing
+int16_t     aqi_sub_index(AqiPollutant p, int32_t conc);            // AQI_MISSING if conc < 0
+AqiResult   aqi_compute(const int32_t conc[AQI_POLLUTANT_COUNT]);
+const char* aqi_pollutant_name(uint8_t p);
+const char* aqi_category(int aqi);                                  // "Good" … "Severe"
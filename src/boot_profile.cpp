@@ -0,0 +1,47 @@
+#include "boot_profile.h"
+#include <esp_timer.h>
+
+struct BootMark {
+    const char* phase;
+    uint32_t    us;
+};
+
+static BootMark marks[BOOT_PROFILE_MAX_MARKS];
+static int      markCount = 0;
+
+// ─── Helpers ─────────────────────────────────────────────────
+static int findMark(const char* phase) {
+    for (int i = 0; i < markCount; i++)
+        if (strcmp(marks[i].phase, phase) == 0) return i;
+    return -1;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void boot_mark(const char* phase) {
+    if (markCount >= BOOT_PROFILE_MAX_MARKS || findMark(phase) >= 0) return;
+    marks[markCount].phase = phase;
+    marks[markCount].us    = (uint32_t)esp_timer_get_time();
+    markCount++;
+}
+
+bool boot_has_mark(const char* phase) { return findMark(phase) >= 0; }
+
+uint32_t boot_mark_us(const char* phase) {
+    int i = findMark(phase);
+    return i < 0 ? 0 : marks[i].us;
+}
+
+void boot_report() {
+    Serial.println("──── Boot report ────────────────────────");
+    uint32_t prev = 0;
+    for (int i = 0; i < markCount; i++) {
+        Serial.printf("  %-14s %7lu us  (+%lu us)\n", marks[i].phase,
+                      (unsigned long)marks[i].us, (unsigned long)(marks[i].us - prev));
+        prev = marks[i].us;
+    }
+    if (boot_has_mark("first_frame"))
+        Serial.printf("  time-to-first-frame: %lu ms\n", (unsigned long)(boot_mark_us("first_frame") / 1000));
+    if (boot_has_mark("wifi_up"))
+        Serial.printf("  time-to-network:     %lu ms\n", (unsigned long)(boot_mark_us("wifi_up") / 1000));
+    Serial.println("─────────────────────────────────────────");
+}
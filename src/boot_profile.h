@@ -0,0 +1,14 @@
+#pragma once
+#include <Arduino.h>
+
+// ─── Boot profiler ──────────────────────────────────────────
+// Timestamps are taken from esp_timer, which starts counting in the
+// second-stage bootloader hand-off, so they are "µs since reset" minus
+// the few ms the ROM loader spends before that.
+#define BOOT_PROFILE_MAX_MARKS 16
+
+// ─── Public API ─────────────────────────────────────────────
+void     boot_mark(const char* phase);        // record end of a boot phase (first call per phase wins)
+bool     boot_has_mark(const char* phase);
+uint32_t boot_mark_us(const char* phase);     // 0 if the phase was never reached
+void     boot_report();                       // print the phase table to Serial
@@ -0,0 +1,122 @@
+#include "clock_source.h"
+#ifdef ARDUINO
+#include <esp_timer.h>
+#endif
+
+struct SimJobStats {
+    uint32_t count;
+    uint64_t total_us;
+    uint32_t max_us;
+};
+
+static int64_t       _start_us    = 0;
+static int64_t       _held_us     = 0;      // real time spent inside held jobs
+static int64_t       _holdStart   = 0;
+static int           _holdDepth   = 0;
+static int64_t       _jobStart[SIM_JOB_COUNT] = {};
+static SimJobStats   _jobs[SIM_JOB_COUNT]     = {};
+static uint32_t      _frames      = 0;
+static uint32_t      _reportHour  = 0;
+static int64_t       _hourReal_us = 0;
+
+static const char* const jobNames[SIM_JOB_COUNT] = { "loop", "wordclock", "screen" };
+
+// ─── Helpers ─────────────────────────────────────────────────
+#ifdef ARDUINO
+static int64_t realUs() { return esp_timer_get_time(); }
+#else
+static int64_t _hostNow_us = 0;             // host builds: moved only by clock_host_advance_us()
+static int64_t realUs() { return _hostNow_us; }
+#endif
+
+// Virtual µs since begin: real time outside held jobs, scaled
+static int64_t virtualUs() {
+    int64_t held = _held_us + (_holdDepth ? realUs() - _holdStart : 0);
+    return (realUs() - _start_us - held) * SIM_CLOCK_RATE;
+}
+
+static uint32_t fnv1a(const uint8_t* data, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) h = (h ^ data[i]) * 16777619u;
+    return h;
+}
+
+static void printClock() {
+    time_t t = clock_utc();
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    Serial.printf("%02d:%02d:%02dZ", tm.tm_hour, tm.tm_min, tm.tm_sec);
+}
+
+static void report() {
+    int64_t now  = realUs();
+    int64_t real = now - _hourReal_us;
+    _hourReal_us = now;
+    Serial.print("SIM ");
+    printClock();
+    Serial.printf(" | hour took %lu ms real (%.0fx) | %lu frames",
+                  (unsigned long)(real / 1000), real > 0 ? 3600e6 / (double)real : 0.0,
+                  (unsigned long)_frames);
+    for (int i = 0; i < SIM_JOB_COUNT; i++) {
+        const SimJobStats& j = _jobs[i];
+        Serial.printf(" | %s %lu avg %lu us max %lu us", jobNames[i], (unsigned long)j.count,
+                      (unsigned long)(j.count ? j.total_us / j.count : 0), (unsigned long)j.max_us);
+    }
+    Serial.println();
+    memset(_jobs, 0, sizeof(_jobs));
+    _frames = 0;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void clock_begin() {
+    _start_us = _hourReal_us = realUs();
+    if (SIM_CLOCK) Serial.printf("✓ Simulated clock at %dx from %lu UTC\n", SIM_CLOCK_RATE,
+                                 (unsigned long)SIM_CLOCK_START_UTC);
+}
+
+bool clock_simulated() { return SIM_CLOCK; }
+
+unsigned long clock_ms() {
+    if (!SIM_CLOCK) return millis();
+    return (unsigned long)(virtualUs() / 1000);
+}
+
+time_t clock_utc() { return (time_t)(SIM_CLOCK_START_UTC + virtualUs() / 1000000); }
+
+void clock_sim_job_begin(SimJob job) {
+    if (!SIM_CLOCK) return;
+    int64_t now = realUs();
+    _jobStart[job] = now;
+    if (job != SIM_JOB_LOOP && _holdDepth++ == 0) _holdStart = now;
+}
+
+void clock_sim_job_end(SimJob job) {
+    if (!SIM_CLOCK) return;
+    int64_t  now = realUs();
+    uint32_t us  = (uint32_t)(now - _jobStart[job]);
+    if (job != SIM_JOB_LOOP && --_holdDepth == 0) _held_us += now - _holdStart;
+    SimJobStats& j = _jobs[job];
+    j.count++;
+    j.total_us += us;
+    j.max_us    = max(j.max_us, us);
+}
+
+void clock_sim_frame(const char* what, const uint8_t* data, size_t len) {
+    if (!SIM_CLOCK) return;
+    _frames++;
+    Serial.print("SIM ");
+    printClock();
+    Serial.printf(" %s %08lx\n", what, (unsigned long)fnv1a(data, len));
+}
+
+void clock_sim_tick() {
+    if (!SIM_CLOCK) return;
+    uint32_t hour = (uint32_t)(clock_utc() / 3600);
+    if (hour == _reportHour) return;
+    if (_reportHour) report();
+    _reportHour = hour;
+}
+
+#ifndef ARDUINO
+void clock_host_advance_us(int64_t us) { _hostNow_us += us; }
+#endif
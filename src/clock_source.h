@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+#include <time.h>
+
+// ─── Clock source ───────────────────────────────────────────
+// Everything that schedules by wall time or uptime reads it from here. In a
+// normal build clock_ms() is millis(). With SIM_CLOCK 1 both run on a virtual
+// clock SIM_CLOCK_RATE times faster than real time, starting at
+// SIM_CLOCK_START_UTC, so a full day of greetings, AM/PM and hour
+// rollovers, sunrise/sunset and carousel laps plays out in about a minute
+// on the device. The network, NTP and RTC are left out in that mode, and
+// so is the history's NVS snapshot.
+//
+// Jobs bracketed with clock_sim_job_begin/end hold the virtual clock while
+// they run, so no scheduled minute is skipped. Their real cost is recorded,
+// and the hourly report doubles as a throughput benchmark for the whole
+// loop. To keep the held time to a few seconds per simulated day, the word
+// clock and the screens change without transitions unless
+// SIM_CLOCK_TRANSITIONS is 1, and the carousel moves on at most every
+// SIM_CAROUSEL_REAL_MS of real time (a screen per ~50 virtual minutes).
+// With transitions on, expect several real minutes per day; the hourly
+// report shows the rate actually reached.
+//
+// Host builds (env:native) have no esp_timer: real time stands still until
+// clock_host_advance_us() moves it, so a simulated day runs as fast as the
+// test can step it and repeats exactly (test/test_sim_clock).
+#ifndef SIM_CLOCK
+#define SIM_CLOCK            0
+#endif
+#ifndef SIM_CLOCK_RATE
+#define SIM_CLOCK_RATE       1440          // virtual seconds per real second (1440 = a day per minute)
+#endif
+#ifndef SIM_CLOCK_START_UTC
+#define SIM_CLOCK_START_UTC  1767205800    // 2025-12-31 18:30 UTC = midnight IST
+#endif
+#ifndef SIM_CLOCK_TRANSITIONS
+#define SIM_CLOCK_TRANSITIONS 0            // 1 = play LED and screen transitions (real time, held)
+#endif
+#define SIM_CAROUSEL_REAL_MS 2000          // real ms between carousel steps in simulation
+
+enum SimJob {
+    SIM_JOB_LOOP      = 0,
+    SIM_JOB_WORDCLOCK = 1,    // wordclock_update incl. the LED transition
+    SIM_JOB_SCREEN    = 2,    // switch_screen incl. the render
+    SIM_JOB_COUNT     = 3
+};
+
+// ─── Public API ─────────────────────────────────────────────
+void          clock_begin();
+bool          clock_simulated();
+unsigned long clock_ms();                          // millis() or virtual ms
+time_t        clock_utc();                         // virtual UTC, only meaningful when simulated
+void          clock_sim_job_begin(SimJob job);
+void          clock_sim_job_end(SimJob job);
+void          clock_sim_frame(const char* what, const uint8_t* data, size_t len);   // logs a hash of the frame
+void          clock_sim_tick();                    // hourly report, once per loop
+#ifndef ARDUINO
+void          clock_host_advance_us(int64_t us);   // host builds only: the real time the clock runs from
+#endif
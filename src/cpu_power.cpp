@@ -0,0 +1,111 @@
+#include "cpu_power.h"
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_idf_version.h>
+#include <driver/ledc.h>
+
+static bool             _managed       = false;
+static esp_pm_lock_handle_t _lock      = NULL;
+static bool             _held          = false;
+static bool             _renderPending = false;
+static bool             _ledBusy       = false;
+static CpuPowerState    _state         = CPU_STATE_IDLE;
+static unsigned long    _stateSince    = 0;
+static uint64_t         _stateMs[CPU_STATE_COUNT] = {};
+
+static const char* const stateNames[CPU_STATE_COUNT] = { "render", "led", "idle" };
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void setHeld(bool held) {
+    if (held == _held) return;
+    _held = held;
+    if (_managed) {
+        if (held) esp_pm_lock_acquire(_lock);
+        else      esp_pm_lock_release(_lock);
+    } else {
+        setCpuFrequencyMhz(held ? CPU_FREQ_MAX_MHZ : CPU_FREQ_MIN_MHZ);
+    }
+}
+
+static void update() {
+    CpuPowerState s = _ledBusy ? CPU_STATE_LED : _renderPending ? CPU_STATE_RENDER : CPU_STATE_IDLE;
+    setHeld(s != CPU_STATE_IDLE);
+    if (s == _state) return;
+    unsigned long ms = millis();
+    _stateMs[_state] += ms - _stateSince;
+    _stateSince = ms;
+    _state      = s;
+}
+
+static void onDisplayEvent(lv_event_t* e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_INVALIDATE_AREA) {
+        _renderPending = true;
+        update();   // raise the clock before the render starts
+    } else if (code == LV_EVENT_REFR_READY) {
+        _renderPending = false;
+    }
+}
+
+// The backlight PWM runs from APB by default, which stops in light sleep.
+// Moving its timer to RC_FAST (kept powered) lets it run through sleep.
+static void keepBacklightInSleep() {
+    ledc_timer_config_t t = {};
+    t.speed_mode      = LEDC_LOW_SPEED_MODE;
+    t.duty_resolution = LEDC_TIMER_8_BIT;
+    t.timer_num       = (ledc_timer_t)CPU_BACKLIGHT_LEDC_TIMER;
+    t.freq_hz         = 1200;
+    t.clk_cfg         = LEDC_USE_RTC8M_CLK;
+    ledc_timer_config(&t);
+    esp_sleep_pd_config(ESP_PD_DOMAIN_RTC8M, ESP_PD_OPTION_ON);
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void cpu_power_begin(lv_display_t* disp) {
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t cfg = {};
+#else
+    esp_pm_config_esp32c3_t cfg = {};
+#endif
+    cfg.max_freq_mhz       = CPU_FREQ_MAX_MHZ;
+    cfg.min_freq_mhz       = CPU_FREQ_MIN_MHZ;
+    cfg.light_sleep_enable = CPU_LIGHT_SLEEP;
+
+    _managed = esp_pm_configure(&cfg) == ESP_OK
+            && esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "lvgl_led", &_lock) == ESP_OK;
+    if (_managed && CPU_LIGHT_SLEEP) keepBacklightInSleep();
+    Serial.printf(_managed ? "✓ PM: DFS %d-%d MHz, light sleep %s\n"
+                           : "✗ PM unavailable — manual DFS %d-%d MHz, light sleep %s\n",
+                  CPU_FREQ_MIN_MHZ, CPU_FREQ_MAX_MHZ, (_managed && CPU_LIGHT_SLEEP) ? "on" : "off");
+
+    lv_display_add_event_cb(disp, onDisplayEvent, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(disp, onDisplayEvent, LV_EVENT_REFR_READY, NULL);
+    _stateSince = millis();
+    _held       = true;     // boot runs at full speed until the first update
+    if (_managed) esp_pm_lock_acquire(_lock);
+    update();
+}
+
+void cpu_power_loop() { update(); }
+
+void cpu_power_led_busy(bool busy) {
+    _ledBusy = busy;
+    update();
+}
+
+bool cpu_power_managed() { return _managed; }
+
+void cpu_power_report() {
+    update();
+    uint64_t now[CPU_STATE_COUNT];
+    uint64_t total = 0;
+    for (int i = 0; i < CPU_STATE_COUNT; i++) {
+        now[i] = _stateMs[i] + (i == _state ? millis() - _stateSince : 0);
+        total += now[i];
+    }
+    if (total == 0) return;
+    Serial.printf("CPU: %s %.1f%% | %s %.1f%% | %s %.1f%%\n",
+                  stateNames[0], 100.0f * now[0] / total,
+                  stateNames[1], 100.0f * now[1] / total,
+                  stateNames[2], 100.0f * now[2] / total);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+// ─── CPU power management ───────────────────────────────────
+// ESP-IDF DFS + automatic light sleep. The CPU runs at CPU_FREQ_MAX_MHZ only
+// while LVGL has invalidated areas to render or an LED transition is
+// playing; otherwise it drops to CPU_FREQ_MIN_MHZ and may light-sleep inside
+// loop()'s delay(). The minimum stays at 80 MHz so APB (and with it the SPI,
+// RMT, I2C and LEDC dividers) never changes.
+#define CPU_FREQ_MAX_MHZ   160
+#define CPU_FREQ_MIN_MHZ   80
+#define CPU_LIGHT_SLEEP    1
+#define CPU_BACKLIGHT_LEDC_TIMER  0    // timer behind the backlight PWM, moved to RC_FAST for light sleep
+
+enum CpuPowerState {
+    CPU_STATE_RENDER = 0,     // LVGL refresh pending
+    CPU_STATE_LED    = 1,     // word clock transition running
+    CPU_STATE_IDLE   = 2,     // lock released: DFS minimum / light sleep allowed
+    CPU_STATE_COUNT  = 3
+};
+
+// ─── Public API ─────────────────────────────────────────────
+void cpu_power_begin(lv_display_t* disp);
+void cpu_power_loop();                  // call right after lv_timer_handler()
+void cpu_power_led_busy(bool busy);     // bracket blocking LED animations
+bool cpu_power_managed();               // false if the IDF PM layer is unavailable (manual DFS fallback)
+void cpu_power_report();
@@ -0,0 +1,187 @@
+#include "forecast.h"
+#include "weather_provider.h"
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+
+#define FORECAST_URL_MAX  200
+
+static char          _url[FORECAST_URL_MAX] = "";
+static ForecastData  _data      = {};
+static ForecastData  _next      = {};          // ingest target, swapped in on success
+static bool          _valid     = false;
+static uint32_t      _serverNow = 0;           // server epoch at the last ingest
+static unsigned long _fetchedMs = 0;
+
+static uint32_t _fetches      = 0;
+static uint32_t _failures     = 0;
+static uint32_t _bytesLast    = 0;
+static uint32_t _peakHeap     = 0;             // largest heap drop during an ingest
+static uint32_t _ingestLast_ms = 0;
+
+// ─── Helpers ─────────────────────────────────────────────────
+static int16_t fixed10(float v) {
+    long x = lroundf(v * 10.0f);
+    return (int16_t)constrain(x, -32768L, 32767L);
+}
+
+static uint8_t sat8(float v) {
+    long x = lroundf(v);
+    return (uint8_t)constrain(x, 0L, 255L);
+}
+
+static void buildFilter(JsonDocument& f) {
+    f["date_epoch"]                         = true;
+    JsonObject d = f["day"].to<JsonObject>();
+    d["maxtemp_c"]                          = true;
+    d["mintemp_c"]                          = true;
+    d["daily_chance_of_rain"]               = true;
+    d["totalprecip_mm"]                     = true;
+    d["condition"]["code"]                  = true;
+    JsonObject h = f["hour"][0].to<JsonObject>();
+    h["time_epoch"]                         = true;
+    h["temp_c"]                             = true;
+    h["chance_of_rain"]                     = true;
+    h["precip_mm"]                          = true;
+    h["condition"]["code"]                  = true;
+}
+
+static void packDay(JsonObject day, uint32_t now) {
+    if (_next.dayCount < FORECAST_DAYS) {
+        JsonObject d = day["day"];
+        ForecastDay& out = _next.days[_next.dayCount++];
+        out.max10   = fixed10(d["maxtemp_c"].as<float>());
+        out.min10   = fixed10(d["mintemp_c"].as<float>());
+        out.rainPct = sat8(d["daily_chance_of_rain"].as<float>());
+        out.precip  = sat8(d["totalprecip_mm"].as<float>());
+        out.code    = d["condition"]["code"].as<uint16_t>();
+    }
+    for (JsonObject h : day["hour"].as<JsonArray>()) {
+        if (_next.hourCount >= FORECAST_HOURS) break;
+        uint32_t t = h["time_epoch"].as<uint32_t>();
+        if (t + 3600 <= now) continue;     // already over
+        if (_next.hourCount == 0) _next.start_epoch = t;
+        ForecastHour& out = _next.hours[_next.hourCount++];
+        out.temp10   = fixed10(h["temp_c"].as<float>());
+        out.rainPct  = sat8(h["chance_of_rain"].as<float>());
+        out.precip10 = sat8(h["precip_mm"].as<float>() * 10.0f);
+        out.code     = h["condition"]["code"].as<uint16_t>();
+    }
+}
+
+// Streams the body: location.localtime_epoch, then each forecastday element
+// parsed on its own. Returns false on any read or parse error.
+static bool ingest(Stream& s, uint32_t* heapLow) {
+    if (!s.find("\"localtime_epoch\":")) return false;
+    uint32_t now = (uint32_t)s.parseInt();
+    if (now == 0 || !s.find("\"forecastday\":[")) return false;
+
+    JsonDocument filter;
+    buildFilter(filter);
+    memset(&_next, 0, sizeof(_next));
+    do {
+        JsonDocument day;
+        DeserializationError error = deserializeJson(day, s, DeserializationOption::Filter(filter));
+        *heapLow = min(*heapLow, (uint32_t)ESP.getFreeHeap());
+        if (error) {
+            Serial.printf("✗ Forecast JSON error: %s\n", error.c_str());
+            return false;
+        }
+        packDay(day.as<JsonObject>(), now);
+    } while (s.findUntil(",", "]"));
+
+    _serverNow = now;
+    return _next.hourCount > 0 && _next.dayCount > 0;
+}
+
+static int currentSlot() {
+    if (!_valid) return -1;
+    uint32_t now = _serverNow + (millis() - _fetchedMs) / 1000;
+    return now < _data.start_epoch ? 0 : (int)((now - _data.start_epoch) / 3600);
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void forecast_begin(const char* base, const char* key, const char* location) {
+    char q[96];
+    if (!url_encode(q, sizeof(q), location)) { _url[0] = '\0'; return; }
+    snprintf(_url, sizeof(_url), "%s/v1/forecast.json?key=%s&q=%s&days=%d&aqi=no&alerts=no",
+             base ? base : weatherapi_provider.defaultBase, key, q, FORECAST_DAYS);
+}
+
+bool forecast_fetch() {
+    if (!_url[0] || WiFi.status() != WL_CONNECTED) return false;
+    _fetches++;
+
+    unsigned long start = millis();
+    HTTPClient http;
+    http.useHTTP10(true);              // no chunked encoding, so the raw stream is the JSON
+    http.setTimeout(FORECAST_TIMEOUT_MS);
+    http.begin(_url);
+    int code = http.GET();
+    if (code != HTTP_CODE_OK) {
+        http.end();
+        _failures++;
+        Serial.printf("✗ Forecast HTTP failed: %d\n", code);
+        return false;
+    }
+
+    int      size       = http.getSize();
+    uint32_t heapBefore = ESP.getFreeHeap();
+    uint32_t heapLow    = heapBefore;
+    Stream&  s          = http.getStream();
+    s.setTimeout(FORECAST_TIMEOUT_MS);
+    bool ok = ingest(s, &heapLow);
+    http.end();
+
+    _ingestLast_ms = millis() - start;
+    _bytesLast     = size > 0 ? size : 0;
+    _peakHeap      = max(_peakHeap, heapBefore - heapLow);
+    if (!ok) {
+        _failures++;
+        Serial.println("✗ Forecast ingest failed, keeping previous data");
+        return false;
+    }
+
+    memcpy(&_data, &_next, sizeof(_data));
+    _valid     = true;
+    _fetchedMs = millis();
+    Serial.printf("✓ Forecast: %d h, %d d | %lu B in, %u B stored | peak heap %lu B | %lums\n",
+                  _data.hourCount, _data.dayCount, (unsigned long)_bytesLast, (unsigned)sizeof(ForecastData),
+                  (unsigned long)(heapBefore - heapLow), (unsigned long)_ingestLast_ms);
+    return true;
+}
+
+bool forecast_valid() { return _valid; }
+
+const ForecastData& forecast() { return _data; }
+
+const ForecastHour* forecast_hour(int ahead) {
+    int slot = currentSlot();
+    if (slot < 0 || ahead < 0 || slot + ahead >= _data.hourCount) return NULL;
+    return &_data.hours[slot + ahead];
+}
+
+int forecast_next_rain_hours(uint8_t minPct) {
+    for (int h = 0; ; h++) {
+        const ForecastHour* f = forecast_hour(h);
+        if (!f) return -1;
+        if (f->rainPct >= minPct) return h;
+    }
+}
+
+bool forecast_temp_delta10(int ahead, int16_t* delta10) {
+    const ForecastHour* now  = forecast_hour(0);
+    const ForecastHour* then = forecast_hour(ahead);
+    if (!now || !then) return false;
+    *delta10 = then->temp10 - now->temp10;
+    return true;
+}
+
+void forecast_report() {
+    Serial.printf("Forecast: %s | %lu fetches %lu failed | %lu B last | stored %u B | peak heap %lu B | "
+                  "ingest %lu ms | next rain %d h\n",
+                  _valid ? "valid" : "none",
+                  (unsigned long)_fetches, (unsigned long)_failures, (unsigned long)_bytesLast,
+                  (unsigned)sizeof(ForecastData), (unsigned long)_peakHeap, (unsigned long)_ingestLast_ms,
+                  forecast_next_rain_hours());
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <Arduino.h>
+
+// ─── Forecast ───────────────────────────────────────────────
+// weatherapi.com forecast.json is 20-30 KB for three days. It is streamed
+// one forecastday at a time through an ArduinoJson filter, so only a single
+// day's document (a few KB) is alive at once, and packed into the fixed-point
+// arrays below (~330 B total). Fetched at a low cadence; screens query it
+// instead of making their own requests.
+#define FORECAST_DAYS          3            // free plan limit
+#define FORECAST_HOURS         48           // hourly slots kept from the current hour on
+#define FORECAST_INTERVAL_MS   10800000UL   // 3 h
+#define FORECAST_RETRY_MS      900000UL     // 15 min after a failed fetch
+#define FORECAST_TIMEOUT_MS    8000
+#define FORECAST_RAIN_PCT      50           // chance of rain that counts as "rain expected"
+
+struct ForecastHour {               // 6 bytes
+    int16_t  temp10;                // 0.1 °C
+    uint8_t  rainPct;               // chance of rain, %
+    uint8_t  precip10;              // 0.1 mm, saturates at 25.5
+    uint16_t code;                  // weatherapi.com condition code
+};
+
+struct ForecastDay {                // 8 bytes
+    int16_t  max10;                 // 0.1 °C
+    int16_t  min10;
+    uint8_t  rainPct;
+    uint8_t  precip;                // mm, saturates at 255
+    uint16_t code;
+};
+
+struct ForecastData {
+    uint32_t     start_epoch;       // UTC start of hours[0]
+    uint8_t      hourCount;
+    uint8_t      dayCount;
+    ForecastHour hours[FORECAST_HOURS];
+    ForecastDay  days[FORECAST_DAYS];
+};
+
+// ─── Public API ─────────────────────────────────────────────
+void                forecast_begin(const char* base, const char* key, const char* location);   // base NULL = weatherapi_provider.defaultBase
+bool                forecast_fetch();                     // blocking, keeps the previous data on failure
+bool                forecast_valid();
+const ForecastData& forecast();
+const ForecastHour* forecast_hour(int ahead);             // 0 = current hour, NULL beyond the data
+int                 forecast_next_rain_hours(uint8_t minPct = FORECAST_RAIN_PCT);   // -1 if none in range
+bool                forecast_temp_delta10(int ahead, int16_t* delta10);             // temp(+ahead) - temp(now)
+void                forecast_report();
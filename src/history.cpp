@@ -0,0 +1,202 @@
+#include "history.h"
+#if HISTORY_NVS
+#include <Preferences.h>
+#endif
+
+#define SAMPLE_MISSING   INT16_MIN
+#define SNAPSHOT_VERSION 1
+
+struct __attribute__((packed)) HistSample {
+    int16_t temp10;       // 0.1 °C, SAMPLE_MISSING for a gap
+    uint8_t hum2;         // 0.5 %RH
+};
+
+struct TierMeta {
+    uint16_t head;        // next write index
+    uint16_t count;
+    uint32_t lastSlot;    // utc / period of the newest stored sample, 0 = empty
+};
+
+struct Tier {
+    HistSample* buf;
+    uint16_t    cap;
+    uint32_t    period_s;
+    TierMeta    m;
+    uint32_t    accSlot;  // slot being averaged, 0 = none
+    int32_t     accT;
+    int32_t     accH;
+    uint16_t    accN;
+};
+
+static HistSample _t0[360];
+static HistSample _t1[288];
+static HistSample _t2[720];
+
+static Tier _tiers[HISTORY_TIER_COUNT] = {
+    { _t0, 360, 60,   {}, 0, 0, 0, 0 },
+    { _t1, 288, 600,  {}, 0, 0, 0, 0 },
+    { _t2, 720, 3600, {}, 0, 0, 0, 0 },
+};
+
+static const char* const tierNames[HISTORY_TIER_COUNT] = { "6 h", "48 h", "30 d" };
+
+static unsigned long _lastSnapshot = 0;
+static uint32_t      _snapshots    = 0;
+static bool          _dirty        = false;
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void pushRaw(Tier& t, HistSample s) {
+    t.buf[t.m.head] = s;
+    t.m.head = (t.m.head + 1) % t.cap;
+    if (t.m.count < t.cap) t.m.count++;
+}
+
+// Stores one finished slot, padding any skipped slots with gaps.
+static void pushSlot(Tier& t, uint32_t slot, HistSample s) {
+    if (t.m.lastSlot && slot <= t.m.lastSlot) return;          // clock stepped back
+    if (t.m.lastSlot) {
+        uint32_t gap = min<uint32_t>(slot - t.m.lastSlot - 1, t.cap);
+        HistSample missing = { SAMPLE_MISSING, 0 };
+        while (gap--) pushRaw(t, missing);
+    }
+    pushRaw(t, s);
+    t.m.lastSlot = slot;
+    _dirty = true;
+}
+
+static HistSample accSample(const Tier& t) {
+    HistSample s = { SAMPLE_MISSING, 0 };
+    if (t.accN) {
+        s.temp10 = (int16_t)(t.accT / t.accN);
+        s.hum2   = (uint8_t)(t.accH / t.accN);
+    }
+    return s;
+}
+
+static void addTo(Tier& t, time_t utc, bool valid, int16_t temp10, uint8_t hum2) {
+    uint32_t slot = (uint32_t)utc / t.period_s;
+    if (slot != t.accSlot) {
+        if (t.accSlot) pushSlot(t, t.accSlot, accSample(t));
+        t.accSlot = slot;
+        t.accT = t.accH = 0;
+        t.accN = 0;
+    }
+    if (!valid) return;
+    t.accT += temp10;
+    t.accH += hum2;
+    t.accN++;
+}
+
+#if HISTORY_NVS
+static const char* const blobKeys[HISTORY_TIER_COUNT] = { "t0", "t1", "t2" };
+
+static void restore() {
+    Preferences p;
+    if (!p.begin("history", true)) return;
+    TierMeta meta[HISTORY_TIER_COUNT];
+    bool ok = p.getUShort("ver", 0) == SNAPSHOT_VERSION
+           && p.getBytes("meta", meta, sizeof(meta)) == sizeof(meta);
+    for (int i = 0; ok && i < HISTORY_TIER_COUNT; i++) {
+        Tier& t = _tiers[i];
+        ok = meta[i].head < t.cap && meta[i].count <= t.cap
+          && p.getBytes(blobKeys[i], t.buf, t.cap * sizeof(HistSample)) == t.cap * sizeof(HistSample);
+        if (ok) t.m = meta[i];
+    }
+    p.end();
+    if (!ok) {
+        for (int i = 0; i < HISTORY_TIER_COUNT; i++) _tiers[i].m = TierMeta{};
+        Serial.println("✗ History snapshot missing or invalid");
+        return;
+    }
+    Serial.printf("✓ History restored: %u / %u / %u samples\n",
+                  _tiers[0].m.count, _tiers[1].m.count, _tiers[2].m.count);
+}
+#endif
+
+// ─── Public ─────────────────────────────────────────────────
+void history_begin() {
+#if HISTORY_NVS
+    restore();
+#endif
+    _lastSnapshot = millis();
+}
+
+void history_add(time_t utc, float temp, float humidity) {
+    int16_t temp10 = (int16_t)constrain(lroundf(temp * 10.0f), -32767L, 32767L);
+    uint8_t hum2   = (uint8_t)constrain(lroundf(humidity * 2.0f), 0L, 200L);
+    for (int i = 0; i < HISTORY_TIER_COUNT; i++) addTo(_tiers[i], utc, true, temp10, hum2);
+}
+
+void history_add_missing(time_t utc) {
+    for (int i = 0; i < HISTORY_TIER_COUNT; i++) addTo(_tiers[i], utc, false, 0, 0);
+}
+
+void history_tick(unsigned long ms) {
+    if (HISTORY_NVS && _dirty && ms - _lastSnapshot >= HISTORY_SNAPSHOT_MS) history_save();
+}
+
+bool history_save() {
+    _lastSnapshot = millis();
+#if HISTORY_NVS
+    Preferences p;
+    if (!p.begin("history", false)) return false;
+    TierMeta meta[HISTORY_TIER_COUNT];
+    bool ok = true;
+    for (int i = 0; i < HISTORY_TIER_COUNT; i++) {
+        const Tier& t = _tiers[i];
+        meta[i] = t.m;
+        ok &= p.putBytes(blobKeys[i], t.buf, t.cap * sizeof(HistSample)) == t.cap * sizeof(HistSample);
+    }
+    ok &= p.putBytes("meta", meta, sizeof(meta)) == sizeof(meta);
+    ok &= p.putUShort("ver", SNAPSHOT_VERSION) == sizeof(uint16_t);
+    p.end();
+    if (ok) {
+        _dirty = false;
+        _snapshots++;
+    } else {
+        Serial.println("✗ History snapshot failed");
+    }
+    return ok;
+#else
+    return false;
+#endif
+}
+
+int history_series(HistoryTier tier, int32_t* temp10, int32_t* hum10, int maxPoints) {
+    if (tier >= HISTORY_TIER_COUNT || maxPoints <= 0) return 0;
+    const Tier& t = _tiers[tier];
+    int total = t.m.count + (t.accN ? 1 : 0);      // include the slot still being averaged
+    if (total == 0) return 0;
+
+    int bucket = (total + maxPoints - 1) / maxPoints;
+    int n      = (total + bucket - 1) / bucket;
+    int pad    = n * bucket - total;               // short first bucket, full newest one
+
+    for (int b = 0; b < n; b++) {
+        int32_t sumT = 0, sumH = 0, cnt = 0;
+        int from = max(0, b * bucket - pad);
+        int to   = (b + 1) * bucket - pad;
+        for (int i = from; i < to; i++) {
+            HistSample s = i < t.m.count ? t.buf[(t.m.head + t.cap - t.m.count + i) % t.cap] : accSample(t);
+            if (s.temp10 == SAMPLE_MISSING) continue;
+            sumT += s.temp10;
+            sumH += s.hum2;
+            cnt++;
+        }
+        temp10[b] = cnt ? sumT / cnt         : HISTORY_MISSING;
+        hum10[b]  = cnt ? sumH * 5 / cnt     : HISTORY_MISSING;
+    }
+    return n;
+}
+
+const char* history_tier_name(HistoryTier tier) {
+    return tier < HISTORY_TIER_COUNT ? tierNames[tier] : "?";
+}
+
+size_t history_bytes() { return sizeof(_t0) + sizeof(_t1) + sizeof(_t2); }
+
+void history_report() {
+    Serial.printf("History: %u / %u / %u samples | %u B | %lu NVS snapshots%s\n",
+                  _tiers[0].m.count, _tiers[1].m.count, _tiers[2].m.count, (unsigned)history_bytes(),
+                  (unsigned long)_snapshots, _dirty ? " (unsaved)" : "");
+}
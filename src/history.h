@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include <time.h>
+#include "clock_source.h"
+
+// ─── Indoor climate history ─────────────────────────────────
+// Three ring buffers at falling resolution, each slot holding the average
+// of the readings that fell into it: 1-minute samples for 6 h, 10-minute
+// for 48 h and hourly for 30 days. A sample is 3 bytes (0.1 °C + 0.5 %RH), ~4 KB in total. Gaps
+// (sensor errors, power loss) are stored as missing samples so the time
+// axis stays linear. Optionally snapshotted to NVS and restored at boot.
+// Series for the chart are averaged down to at most the requested number of
+// points before LVGL sees them.
+#ifndef HISTORY_NVS
+#define HISTORY_NVS              1            // 0 = RAM only
+#endif
+#if SIM_CLOCK
+#undef  HISTORY_NVS
+#define HISTORY_NVS              0            // simulated days never reach the real snapshot
+#endif
+#define HISTORY_SNAPSHOT_MS      3600000UL    // NVS write interval (~4 KB each)
+#define HISTORY_SAMPLE_MS        60000UL
+
+enum HistoryTier {
+    HISTORY_6H  = 0,      // 360 × 1 min
+    HISTORY_48H = 1,      // 288 × 10 min
+    HISTORY_30D = 2,      // 720 × 1 h
+    HISTORY_TIER_COUNT = 3
+};
+
+#define HISTORY_MISSING  INT32_MAX    // value written for empty buckets, same as LV_CHART_POINT_NONE
+
+// ─── Public API ─────────────────────────────────────────────
+void        history_begin();                                   // restores the NVS snapshot if enabled
+void        history_add(time_t utc, float temp, float humidity);
+void        history_add_missing(time_t utc);                   // failed read, keeps the slot explicit
+void        history_tick(unsigned long ms);                     // snapshots to NVS when due
+bool        history_save();
+// Oldest → newest, averaged into at most maxPoints buckets. temp in 0.1 °C,
+// humidity in 0.1 %RH. Returns the number of points written.
+int         history_series(HistoryTier tier, int32_t* temp10, int32_t* hum10, int maxPoints);
+const char* history_tier_name(HistoryTier tier);
+size_t      history_bytes();
+void        history_report();
@@ -0,0 +1,95 @@
+#include "history_screen.h"
+
+lv_obj_t* ui_History           = NULL;
+lv_obj_t* ui_HistoryTitle      = NULL;
+lv_obj_t* ui_HistoryRange      = NULL;
+lv_obj_t* ui_HistoryChart      = NULL;
+lv_obj_t* ui_HistoryTempLegend = NULL;
+lv_obj_t* ui_HistoryHumLegend  = NULL;
+
+// ─── Public ─────────────────────────────────────────────────
+void history_screen_init() {
+    ui_History = lv_obj_create(NULL);
+    lv_obj_remove_flag(ui_History, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(ui_History, lv_color_hex(0x0F0F0F), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(ui_History, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    ui_HistoryTitle = lv_label_create(ui_History);
+    lv_obj_set_width(ui_HistoryTitle, LV_SIZE_CONTENT);
+    lv_obj_set_height(ui_HistoryTitle, LV_SIZE_CONTENT);
+    lv_obj_set_x(ui_HistoryTitle, 12);
+    lv_obj_set_y(ui_HistoryTitle, 10);
+    lv_label_set_text(ui_HistoryTitle, "Living Room");
+    lv_obj_set_style_text_color(ui_HistoryTitle, lv_color_hex(0x6CF3F2), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_opa(ui_HistoryTitle, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_HistoryTitle, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    ui_HistoryRange = lv_label_create(ui_History);
+    lv_obj_set_width(ui_HistoryRange, LV_SIZE_CONTENT);
+    lv_obj_set_height(ui_HistoryRange, LV_SIZE_CONTENT);
+    lv_obj_set_x(ui_HistoryRange, -12);
+    lv_obj_set_y(ui_HistoryRange, 10);
+    lv_obj_set_align(ui_HistoryRange, LV_ALIGN_TOP_RIGHT);
+    lv_label_set_text(ui_HistoryRange, "6 h");
+    lv_obj_set_style_text_color(ui_HistoryRange, lv_color_hex(0xCED0CE), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_opa(ui_HistoryRange, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_HistoryRange, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    ui_HistoryChart = lv_chart_create(ui_History);
+    lv_obj_set_width(ui_HistoryChart, 300);
+    lv_obj_set_height(ui_HistoryChart, 160);
+    lv_obj_set_x(ui_HistoryChart, 0);
+    lv_obj_set_y(ui_HistoryChart, 8);
+    lv_obj_set_align(ui_HistoryChart, LV_ALIGN_CENTER);
+    lv_chart_set_type(ui_HistoryChart, LV_CHART_TYPE_LINE);
+    lv_chart_set_point_count(ui_HistoryChart, 0);
+    lv_chart_set_div_line_count(ui_HistoryChart, 5, 0);
+    lv_chart_set_range(ui_HistoryChart, LV_CHART_AXIS_SECONDARY_Y, 0, 1000);
+    lv_chart_add_series(ui_HistoryChart, lv_color_hex(0xFF9900), LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_add_series(ui_HistoryChart, lv_color_hex(0x3399FF), LV_CHART_AXIS_SECONDARY_Y);
+    lv_obj_set_style_bg_color(ui_HistoryChart, lv_color_hex(0x0F0F0F), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(ui_HistoryChart, 125, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_color(ui_HistoryChart, lv_color_hex(0x201F1F), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_opa(ui_HistoryChart, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_line_color(ui_HistoryChart, lv_color_hex(0x201F1F), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_line_opa(ui_HistoryChart, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_left(ui_HistoryChart, 4, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_right(ui_HistoryChart, 4, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_top(ui_HistoryChart, 6, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_bottom(ui_HistoryChart, 6, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_line_width(ui_HistoryChart, 2, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_width(ui_HistoryChart, 0, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_set_style_height(ui_HistoryChart, 0, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+
+    ui_HistoryTempLegend = lv_label_create(ui_History);
+    lv_obj_set_width(ui_HistoryTempLegend, LV_SIZE_CONTENT);
+    lv_obj_set_height(ui_HistoryTempLegend, LV_SIZE_CONTENT);
+    lv_obj_set_x(ui_HistoryTempLegend, 12);
+    lv_obj_set_y(ui_HistoryTempLegend, -8);
+    lv_obj_set_align(ui_HistoryTempLegend, LV_ALIGN_BOTTOM_LEFT);
+    lv_label_set_text(ui_HistoryTempLegend, "-- °C");
+    lv_obj_set_style_text_color(ui_HistoryTempLegend, lv_color_hex(0xFF9900), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_opa(ui_HistoryTempLegend, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_HistoryTempLegend, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    ui_HistoryHumLegend = lv_label_create(ui_History);
+    lv_obj_set_width(ui_HistoryHumLegend, LV_SIZE_CONTENT);
+    lv_obj_set_height(ui_HistoryHumLegend, LV_SIZE_CONTENT);
+    lv_obj_set_x(ui_HistoryHumLegend, -12);
+    lv_obj_set_y(ui_HistoryHumLegend, -8);
+    lv_obj_set_align(ui_HistoryHumLegend, LV_ALIGN_BOTTOM_RIGHT);
+    lv_label_set_text(ui_HistoryHumLegend, "-- %RH");
+    lv_obj_set_style_text_color(ui_HistoryHumLegend, lv_color_hex(0x3399FF), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_opa(ui_HistoryHumLegend, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_HistoryHumLegend, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+}
+
+void history_screen_destroy() {
+    if (ui_History) lv_obj_delete(ui_History);
+    ui_History           = NULL;
+    ui_HistoryTitle      = NULL;
+    ui_HistoryRange      = NULL;
+    ui_HistoryChart      = NULL;
+    ui_HistoryTempLegend = NULL;
+    ui_HistoryHumLegend  = NULL;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <lvgl.h>
+
+// ─── History screen ─────────────────────────────────────────
+// The indoor climate chart (see history.h). It is written by hand, not
+// exported from SquareLine Studio, so it lives outside src/ui and an export
+// can't overwrite or drop it. main builds it on first use like the other
+// screens and fills it in update_history_screen(); the SquareLine project
+// and ui_init() don't know about it.
+
+// ─── Public API ─────────────────────────────────────────────
+void history_screen_init();
+void history_screen_destroy();
+
+extern lv_obj_t* ui_History;
+extern lv_obj_t* ui_HistoryTitle;
+extern lv_obj_t* ui_HistoryRange;
+extern lv_obj_t* ui_HistoryChart;
+extern lv_obj_t* ui_HistoryTempLegend;
+extern lv_obj_t* ui_HistoryHumLegend;
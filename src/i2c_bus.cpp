@@ -0,0 +1,152 @@
+#include "i2c_bus.h"
+#include <Wire.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+struct I2cJob {
+    uint8_t type;
+    void*   cb;
+    int64_t queued_us;
+};
+
+struct I2cResult {
+    uint8_t  type;
+    bool     ok;
+    void*    cb;
+    uint32_t unixtime;
+    float    temp;
+    float    humidity;
+};
+
+static RTC_DS3231*       _rtc     = NULL;
+static Adafruit_SHT31*   _sht     = NULL;
+static QueueHandle_t     _jobs    = NULL;
+static QueueHandle_t     _results = NULL;
+static SemaphoreHandle_t _mutex   = NULL;
+static int64_t           _lockedAt = 0;
+static I2cBusStats       _stats   = {};
+static portMUX_TYPE      _statsMux = portMUX_INITIALIZER_UNLOCKED;   // _stats is written by both tasks
+
+static const char* const jobNames[I2C_JOB_COUNT] = { "rtc", "sht" };
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void runJob(const I2cJob& job, I2cResult& r) {
+    switch (job.type) {
+    case I2C_JOB_RTC_TIME: {
+        DateTime t = _rtc->now();
+        r.ok       = t.isValid() && t.year() >= 2020;    // a failed read decodes 0xFF registers
+        r.unixtime = t.unixtime();
+        break;
+    }
+    case I2C_JOB_SHT_READ:
+        r.ok = _sht->readBoth(&r.temp, &r.humidity);
+        break;
+    }
+}
+
+static void busTask(void*) {
+    I2cJob job;
+    for (;;) {
+        if (xQueueReceive(_jobs, &job, portMAX_DELAY) != pdTRUE) continue;
+        I2cResult r = {};
+        r.type = job.type;
+        r.cb   = job.cb;
+
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        int64_t start = esp_timer_get_time();
+        runJob(job, r);
+        int64_t end = esp_timer_get_time();
+        xSemaphoreGive(_mutex);
+
+        bool sent = xQueueSend(_results, &r, 0) == pdTRUE;
+
+        portENTER_CRITICAL(&_statsMux);
+        _stats.busy_us += end - start;
+        _stats.jobs[job.type]++;
+        if (!r.ok) _stats.errors[job.type]++;
+        _stats.latencyMax_us = max(_stats.latencyMax_us, (uint32_t)(end - job.queued_us));
+        if (!sent) _stats.dropped++;
+        portEXIT_CRITICAL(&_statsMux);
+    }
+}
+
+static bool enqueue(uint8_t type, void* cb) {
+    if (!_jobs) return false;
+    I2cJob job = { type, cb, esp_timer_get_time() };
+    if (xQueueSend(_jobs, &job, 0) == pdTRUE) return true;
+    portENTER_CRITICAL(&_statsMux);
+    _stats.dropped++;
+    portEXIT_CRITICAL(&_statsMux);
+    return false;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+bool i2c_bus_begin(int sda, int scl) {
+    Wire.begin(sda, scl, I2C_BUS_HZ);
+    _mutex   = xSemaphoreCreateMutex();
+    _jobs    = xQueueCreate(I2C_QUEUE_LEN, sizeof(I2cJob));
+    _results = xQueueCreate(I2C_QUEUE_LEN, sizeof(I2cResult));
+    _stats.since_us = esp_timer_get_time();
+    if (!_mutex || !_jobs || !_results ||
+        xTaskCreate(busTask, "i2c_bus", I2C_TASK_STACK, NULL, I2C_TASK_PRIORITY, NULL) != pdPASS) {
+        Serial.println("✗ I2C bus task failed");
+        _jobs = NULL;
+        return false;
+    }
+    return true;
+}
+
+void i2c_bus_attach(RTC_DS3231* rtc, Adafruit_SHT31* sht) {
+    _rtc = rtc;
+    _sht = sht;
+}
+
+bool i2c_bus_read_rtc(I2cRtcCallback cb) { return _rtc && enqueue(I2C_JOB_RTC_TIME, (void*)cb); }
+
+bool i2c_bus_read_sht(I2cShtCallback cb) { return _sht && enqueue(I2C_JOB_SHT_READ, (void*)cb); }
+
+void i2c_bus_poll() {
+    if (!_results) return;
+    I2cResult r;
+    while (xQueueReceive(_results, &r, 0) == pdTRUE) {
+        if (!r.cb) continue;
+        if (r.type == I2C_JOB_RTC_TIME) ((I2cRtcCallback)r.cb)(r.ok, r.unixtime);
+        else                            ((I2cShtCallback)r.cb)(r.ok, r.temp, r.humidity);
+    }
+}
+
+void i2c_bus_lock() {
+    if (_mutex) xSemaphoreTake(_mutex, portMAX_DELAY);
+    _lockedAt = esp_timer_get_time();
+}
+
+void i2c_bus_unlock() {
+    int64_t held = esp_timer_get_time() - _lockedAt;
+    portENTER_CRITICAL(&_statsMux);
+    _stats.locked_us += held;
+    portEXIT_CRITICAL(&_statsMux);
+    if (_mutex) xSemaphoreGive(_mutex);
+}
+
+I2cBusStats i2c_bus_stats() {
+    portENTER_CRITICAL(&_statsMux);
+    I2cBusStats s = _stats;
+    portEXIT_CRITICAL(&_statsMux);
+    return s;
+}
+
+void i2c_bus_report() {
+    I2cBusStats s      = i2c_bus_stats();
+    int64_t     window = esp_timer_get_time() - s.since_us;
+    if (window <= 0) return;
+    Serial.printf("I2C: %s %lu/%lu err | %s %lu/%lu err | dropped %lu | busy %.3f%% (sync %.3f%%) | max latency %lu us\n",
+                  jobNames[0], (unsigned long)s.jobs[0], (unsigned long)s.errors[0],
+                  jobNames[1], (unsigned long)s.jobs[1], (unsigned long)s.errors[1],
+                  (unsigned long)s.dropped,
+                  100.0f * (float)(s.busy_us + s.locked_us) / (float)window,
+                  100.0f * (float)s.locked_us / (float)window,
+                  (unsigned long)s.latencyMax_us);
+}
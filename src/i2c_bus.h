@@ -0,0 +1,47 @@
+#pragma once
+#include <Arduino.h>
+#include <RTClib.h>
+#include <Adafruit_SHT31.h>
+
+// ─── I2C bus manager ────────────────────────────────────────
+// Routine reads (RTC time, SHT30 temperature + humidity) are queued and run
+// by a dedicated task. The IDF I2C driver blocks that task on the transfer
+// interrupt, so loop() keeps rendering while the bus is busy. Results come
+// back through a second queue and the callbacks run inside i2c_bus_poll(),
+// i.e. on the loop task, where touching LVGL is safe.
+// Multi-step transactions made directly with Wire/RTClib (setup, NTP
+// drift handling) must hold i2c_bus_lock() so they don't interleave.
+#define I2C_BUS_HZ            400000
+#define I2C_QUEUE_LEN         8
+#define I2C_TASK_STACK        3072
+#define I2C_TASK_PRIORITY     2           // above loopTask so a queued read starts immediately
+
+enum I2cJobType {
+    I2C_JOB_RTC_TIME = 0,     // one 7-register burst read
+    I2C_JOB_SHT_READ = 1,     // one single-shot measurement, temperature and humidity together
+    I2C_JOB_COUNT    = 2
+};
+
+typedef void (*I2cRtcCallback)(bool ok, uint32_t unixtime);
+typedef void (*I2cShtCallback)(bool ok, float temp, float humidity);
+
+struct I2cBusStats {
+    uint32_t jobs[I2C_JOB_COUNT];
+    uint32_t errors[I2C_JOB_COUNT];
+    uint32_t dropped;                   // queue full, job or result discarded
+    uint32_t latencyMax_us;             // enqueue → result available
+    uint64_t busy_us;                   // time the bus was held by the task
+    uint64_t locked_us;                 // time the bus was held through i2c_bus_lock()
+    uint64_t since_us;                  // start of the measurement window
+};
+
+// ─── Public API ─────────────────────────────────────────────
+bool               i2c_bus_begin(int sda, int scl);     // Wire.begin + task; false if the task could not start
+void               i2c_bus_attach(RTC_DS3231* rtc, Adafruit_SHT31* sht);    // NULL for absent devices
+bool               i2c_bus_read_rtc(I2cRtcCallback cb);  // false if the queue is full or no RTC
+bool               i2c_bus_read_sht(I2cShtCallback cb);
+void               i2c_bus_poll();                       // call every loop(); runs pending callbacks
+void               i2c_bus_lock();
+void               i2c_bus_unlock();
+I2cBusStats        i2c_bus_stats();                      // consistent snapshot
+void               i2c_bus_report();
@@ -0,0 +1,95 @@
+#pragma once
+#include <stdint.h>
+#include <type_traits>
+
+// ─── LED matrix geometry ────────────────────────────────────
+// Maps a cell of the face (row 0 at the top, col 0 on the left, as read from
+// the front) to its position on the LED strip. The panel is described in its
+// own orientation — the corner the strip starts in, whether it runs along
+// rows or columns and whether every other line runs back — and then how it
+// is mounted behind the face: turned clockwise by a multiple of 90° and/or
+// mirrored (seen from the back). The whole map is a constexpr table, so a
+// pixel access is one load.
+enum MatrixOrigin : uint8_t {
+    MATRIX_TOP_LEFT     = 0,
+    MATRIX_TOP_RIGHT    = 1,
+    MATRIX_BOTTOM_LEFT  = 2,
+    MATRIX_BOTTOM_RIGHT = 3
+};
+
+enum MatrixLayout : uint8_t {
+    MATRIX_ROWS_SERPENTINE  = 0,    // along rows, alternate rows reversed
+    MATRIX_ROWS_PROGRESSIVE = 1,    // along rows, every row the same way
+    MATRIX_COLS_SERPENTINE  = 2,
+    MATRIX_COLS_PROGRESSIVE = 3
+};
+
+enum MatrixRotation : uint8_t {
+    MATRIX_ROT_0   = 0,
+    MATRIX_ROT_90  = 1,             // panel turned 90° clockwise behind the face
+    MATRIX_ROT_180 = 2,
+    MATRIX_ROT_270 = 3
+};
+
+template <uint8_t Rows, uint8_t Cols, MatrixOrigin Origin, MatrixLayout Layout,
+          MatrixRotation Rotation = MATRIX_ROT_0, bool Mirror = false>
+struct LedMatrix {
+    static constexpr uint8_t  rows  = Rows;    // face orientation
+    static constexpr uint8_t  cols  = Cols;
+    static constexpr uint16_t count = Rows * Cols;
+
+    using Index = typename std::conditional<(Rows * Cols <= 256), uint8_t, uint16_t>::type;
+
+    // Strip position of face cell (row, col); only used to build the table.
+    static constexpr uint16_t wire(int row, int col) {
+        bool quarter = Rotation == MATRIX_ROT_90 || Rotation == MATRIX_ROT_270;
+        int  pRows   = quarter ? Cols : Rows;
+        int  pCols   = quarter ? Rows : Cols;
+        int  pr = row, pc = col;
+        switch (Rotation) {
+            case MATRIX_ROT_90:  pr = Cols - 1 - col; pc = row;            break;
+            case MATRIX_ROT_180: pr = Rows - 1 - row; pc = Cols - 1 - col; break;
+            case MATRIX_ROT_270: pr = col;            pc = Rows - 1 - row; break;
+            default:                                                       break;
+        }
+        if (Mirror) pc = pCols - 1 - pc;
+        if (Origin == MATRIX_BOTTOM_LEFT || Origin == MATRIX_BOTTOM_RIGHT) pr = pRows - 1 - pr;
+        if (Origin == MATRIX_TOP_RIGHT   || Origin == MATRIX_BOTTOM_RIGHT) pc = pCols - 1 - pc;
+
+        bool byRows = Layout == MATRIX_ROWS_SERPENTINE || Layout == MATRIX_ROWS_PROGRESSIVE;
+        bool snake  = Layout == MATRIX_ROWS_SERPENTINE || Layout == MATRIX_COLS_SERPENTINE;
+        int  line   = byRows ? pr : pc;
+        int  pos    = byRows ? pc : pr;
+        int  len    = byRows ? pCols : pRows;
+        if (snake && (line & 1)) pos = len - 1 - pos;
+        return (uint16_t)(line * len + pos);
+    }
+
+    struct Table {
+        Index at[Rows][Cols];
+    };
+
+    static constexpr Table build() {
+        Table t = {};
+        for (int r = 0; r < Rows; r++)
+            for (int c = 0; c < Cols; c++) t.at[r][c] = (Index)wire(r, c);
+        return t;
+    }
+
+    static constexpr Table table = build();
+
+    static constexpr Index at(int row, int col) { return table.at[row][col]; }
+
+    // Every strip position used exactly once; for a static_assert next to the
+    // configuration.
+    static constexpr bool valid() {
+        bool seen[Rows * Cols] = {};
+        for (int r = 0; r < Rows; r++)
+            for (int c = 0; c < Cols; c++) {
+                uint16_t i = wire(r, c);
+                if (i >= count || seen[i]) return false;
+                seen[i] = true;
+            }
+        return true;
+    }
+};
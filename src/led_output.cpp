@@ -0,0 +1,117 @@
+#include "led_output.h"
+#include "led_trace.h"
+#include "word_clock.h"
+#include <esp_pm.h>
+#include <esp_timer.h>
+
+static CLEDController*      _ctrl    = NULL;
+static TaskHandle_t         _task    = NULL;
+static SemaphoreHandle_t    _idle    = NULL;   // given while the front buffer is free
+static esp_pm_lock_handle_t _pmLock  = NULL;
+static CRGB                 _front[NUM_LEDS];
+
+struct OutputStats {
+    uint32_t frames;
+    uint32_t stalls;        // hand-overs that had to wait for the previous frame
+    uint64_t wire_us;       // transmit time, output task or caller
+    uint32_t wireMax_us;
+    uint64_t caller_us;     // time led_show() held the caller
+    uint32_t callerMax_us;
+    uint64_t active_us;     // gaps between shows inside animations
+    uint32_t activeGaps;
+};
+static OutputStats  _stats    = {};
+static portMUX_TYPE _statsMux = portMUX_INITIALIZER_UNLOCKED;   // wire_us/wireMax_us come from the output task
+static int64_t      _lastShow = 0;
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void transmit(const CRGB* px) {
+    if (_pmLock) esp_pm_lock_acquire(_pmLock);
+    int64_t t = esp_timer_get_time();
+    if (_ctrl) _ctrl->show(px, NUM_LEDS, FastLED.getBrightness());
+    else       FastLED.show();
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t);
+    if (_pmLock) esp_pm_lock_release(_pmLock);
+    portENTER_CRITICAL(&_statsMux);
+    _stats.wire_us   += us;
+    _stats.wireMax_us = max(_stats.wireMax_us, us);
+    portEXIT_CRITICAL(&_statsMux);
+}
+
+static void outputTask(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        transmit(_front);
+        xSemaphoreGive(_idle);
+    }
+}
+
+// Returns true if it had to wait for the previous frame.
+static bool handOver() {
+    bool stalled = xSemaphoreTake(_idle, 0) != pdTRUE;
+    if (stalled) xSemaphoreTake(_idle, portMAX_DELAY);
+    memcpy(_front, leds, sizeof(_front));
+    xTaskNotifyGive(_task);
+    return stalled;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void led_output_begin(CLEDController* ctrl) {
+    _ctrl = ctrl;
+    if (esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "led_out", &_pmLock) != ESP_OK) _pmLock = NULL;
+    if (!LED_OUTPUT_ASYNC) return;
+    _idle = xSemaphoreCreateBinary();
+    if (_idle && xTaskCreate(outputTask, "led_out", LED_OUTPUT_STACK, NULL, LED_OUTPUT_PRIO, &_task) == pdPASS) {
+        xSemaphoreGive(_idle);
+        Serial.println("✓ LED output task running");
+        return;
+    }
+    _task = NULL;
+    Serial.println("✗ LED output task failed, showing synchronously");
+}
+
+void led_show() {
+    int64_t t       = esp_timer_get_time();
+    bool    stalled = false;
+    if (_task) stalled = handOver();
+    else       transmit(leds);
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t);
+
+    portENTER_CRITICAL(&_statsMux);
+    _stats.frames++;
+    if (stalled) _stats.stalls++;
+    _stats.caller_us   += us;
+    _stats.callerMax_us = max(_stats.callerMax_us, us);
+    if (_lastShow && t - _lastShow < (int64_t)LED_OUTPUT_BURST_MS * 1000) {
+        _stats.active_us += t - _lastShow;
+        _stats.activeGaps++;
+    }
+    portEXIT_CRITICAL(&_statsMux);
+    _lastShow = t;
+    led_trace_frame(t, us);
+}
+
+void led_output_wait() {
+    if (!_task) return;
+    xSemaphoreTake(_idle, portMAX_DELAY);
+    xSemaphoreGive(_idle);
+}
+
+// Achievable fps is what the wire alone allows; animation fps and the busy
+// shares are measured inside bursts of shows, so idle minutes don't dilute them.
+void led_output_report() {
+    portENTER_CRITICAL(&_statsMux);
+    OutputStats s = _stats;
+    _stats = {};
+    portEXIT_CRITICAL(&_statsMux);
+    if (!s.frames) return;
+    float wireAvg = (float)s.wire_us / s.frames;
+    float fps     = s.activeGaps ? 1e6f * s.activeGaps / s.active_us : 0.0f;
+    Serial.printf("LED out: %s | %lu frames, %lu stalls | wire avg %.2f ms max %.2f ms (%.0f fps max) | "
+                  "show() avg %.2f ms max %.2f ms | animating %.1f fps, wire %.0f%% caller %.0f%%\n",
+                  _task ? "async" : "sync", (unsigned long)s.frames, (unsigned long)s.stalls,
+                  wireAvg / 1000.0f, s.wireMax_us / 1000.0f, wireAvg > 0 ? 1e6f / wireAvg : 0.0f,
+                  (float)s.caller_us / s.frames / 1000.0f, s.callerMax_us / 1000.0f, fps,
+                  s.active_us ? 100.0f * s.wire_us / s.active_us : 0.0f,
+                  s.active_us ? 100.0f * s.caller_us / s.active_us : 0.0f);
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+
+// ─── LED output stage ───────────────────────────────────────
+// led_show() stands in for FastLED.show() everywhere. With LED_OUTPUT_ASYNC
+// the frame in leds[] is copied to a front buffer and handed to an output
+// task, which transmits it over RMT while the caller goes on drawing the next
+// frame into leds[]. The caller only waits when it hands over a frame before
+// the previous one is on the wire. leds[] stays the back buffer the effects
+// draw into incrementally, so the hand-off is a copy (3 bytes per LED), not a
+// pointer swap.
+// The output task holds a no-light-sleep PM lock while transmitting.
+#ifndef LED_OUTPUT_ASYNC
+#define LED_OUTPUT_ASYNC      1        // 0 = transmit on the calling task, as FastLED.show() did
+#endif
+#define LED_OUTPUT_PRIO       5        // above loopTask (1), so a frame starts as soon as it's handed over
+#define LED_OUTPUT_STACK      3072
+#define LED_OUTPUT_BURST_MS   100      // shows closer than this count as one animation
+
+// ─── Public API ─────────────────────────────────────────────
+void led_output_begin(CLEDController* ctrl);   // after FastLED.addLeds(); starts the output task
+void led_show();                               // hands leds[] over for transmission
+void led_output_wait();                        // returns once the last frame is on the wire
+void led_output_report();
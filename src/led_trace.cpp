@@ -0,0 +1,115 @@
+#include "led_trace.h"
+#include "word_clock.h"
+#include <esp_timer.h>
+
+#define TRACE_FLAG_TRUNCATED  0x01
+#define HEADER_BYTES          8
+#define FRAME_HEADER_BYTES    8
+#define ENTRY_BYTES           5
+
+static uint8_t*  _buf        = NULL;
+static size_t    _len        = 0;
+static bool      _open       = false;
+static char      _label[16]  = {0};
+static int64_t   _start_us   = 0;
+static CRGB      _prev[NUM_LEDS];
+
+static uint32_t  _traces     = 0;
+static uint32_t  _frames     = 0;       // in the open trace
+static uint32_t  _truncated  = 0;
+static uint32_t  _lastBytes  = 0;
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void put16(uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void put32(uint8_t* p, uint32_t v) { put16(p, v); put16(p + 2, v >> 16); }
+
+// Once a frame is dropped the trace ends there: a later, smaller frame
+// would leave a gap that reads as a stall.
+static void appendFrame(uint32_t t_us, uint16_t show_us) {
+    if (_buf[6] & TRACE_FLAG_TRUNCATED) return;
+    uint16_t count = 0;
+    for (int i = 0; i < NUM_LEDS; i++) count += leds[i] != _prev[i];
+    size_t need = FRAME_HEADER_BYTES + (size_t)count * ENTRY_BYTES;
+    if (_len + need > LED_TRACE_BYTES) {
+        _buf[6] |= TRACE_FLAG_TRUNCATED;
+        return;
+    }
+    uint8_t* p = _buf + _len;
+    put32(p, t_us);
+    put16(p + 4, show_us);
+    put16(p + 6, count);
+    p += FRAME_HEADER_BYTES;
+    for (int i = 0; i < NUM_LEDS; i++) {
+        if (leds[i] == _prev[i]) continue;
+        put16(p, i);
+        p[2] = leds[i].r;
+        p[3] = leds[i].g;
+        p[4] = leds[i].b;
+        p += ENTRY_BYTES;
+        _prev[i] = leds[i];
+    }
+    _len += need;
+    _frames++;
+}
+
+static void dump() {
+    Serial.printf("LEDTRACE %s %u\n", _label, (unsigned)_len);
+    static const char hex[] = "0123456789abcdef";
+    char line[129];
+    for (size_t i = 0; i < _len; i += 64) {
+        size_t n = min<size_t>(64, _len - i);
+        for (size_t k = 0; k < n; k++) {
+            line[k * 2]     = hex[_buf[i + k] >> 4];
+            line[k * 2 + 1] = hex[_buf[i + k] & 0x0F];
+        }
+        line[n * 2] = 0;
+        Serial.println(line);
+    }
+    Serial.println("LEDTRACE END");
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void led_trace_frame(int64_t t_us, uint32_t show_us) {
+    if (!_open) return;
+    appendFrame((uint32_t)(t_us - _start_us), (uint16_t)min<uint32_t>(show_us, 0xFFFF));
+}
+
+bool led_trace_begin(const char* label) {
+    if (!LED_TRACE) return false;
+    if (!_buf) _buf = (uint8_t*)malloc(LED_TRACE_BYTES);
+    if (!_buf) {
+        Serial.println("✗ LED trace buffer allocation failed");
+        return false;
+    }
+    memcpy(_buf, "LTR1", 4);
+    put16(_buf + 4, NUM_LEDS);
+    put16(_buf + 6, 0);
+    _len = HEADER_BYTES;
+    for (int i = 0; i < NUM_LEDS; i++) {
+        _prev[i] = leds[i];
+        _buf[_len++] = leds[i].r;
+        _buf[_len++] = leds[i].g;
+        _buf[_len++] = leds[i].b;
+    }
+    snprintf(_label, sizeof(_label), "%s", label);
+    _frames   = 0;
+    _start_us = esp_timer_get_time();
+    _open     = true;
+    return true;
+}
+
+void led_trace_end() {
+    if (!_open) return;
+    _open = false;
+    _traces++;
+    _lastBytes = _len;
+    if (_buf[6] & TRACE_FLAG_TRUNCATED) _truncated++;
+    dump();
+}
+
+void led_trace_report() {
+    if (!LED_TRACE) return;
+    Serial.printf("LED trace: %lu traces (%lu truncated) | last %lu B, %lu frames\n",
+                  (unsigned long)_traces, (unsigned long)_truncated,
+                  (unsigned long)_lastBytes, (unsigned long)_frames);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+
+// ─── LED frame trace ────────────────────────────────────────
+// While a trace is open every frame passed to led_show() is appended to a RAM buffer as the LEDs that changed
+// since the previous one, with its timestamp and the time show() took. On
+// close the trace is written to Serial as hex between LEDTRACE lines;
+// tools/led_trace.py pulls it out of a serial log and renders it to the
+// terminal, an animated GIF or a frame pacing report.
+//
+// Trace layout, little endian:
+//   "LTR1"  u16 numLeds  u16 flags (bit 0 = truncated)
+//   numLeds × {r, g, b}                      LED state when the trace opened
+//   per frame: u32 t_us  u16 show_us  u16 count, then count × {u16 index, r, g, b}
+// show_us is how long led_show() held the caller (see led_output.h). A
+// truncated trace ends at the last frame that fit; nothing after it is kept.
+#ifndef LED_TRACE
+#define LED_TRACE        0          // 1 = trace every word clock update
+#endif
+#define LED_TRACE_BYTES  24576      // heap, allocated on the first trace
+
+// ─── Public API ─────────────────────────────────────────────
+void led_trace_frame(int64_t t_us, uint32_t show_us);   // from led_show(), no-op unless a trace is open
+bool led_trace_begin(const char* label);        // no-op unless LED_TRACE
+void led_trace_end();                           // closes and dumps the open trace
+void led_trace_report();
@@ -0,0 +1,59 @@
+#include "lvgl_heap.h"
+#include "ui_anim_pool.h"
+
+struct HeapHour {
+    uint32_t biggestMin;      // 0 = no sample yet
+    uint8_t  fragMax;
+};
+
+static HeapHour      _hours[LVGL_HEAP_HOURS] = {};
+static uint8_t       _hour       = 0;
+static uint8_t       _hourCount  = 0;
+static uint8_t       _samples    = 0;      // within the current hour
+static unsigned long _lastSample = 0;
+static lv_mem_monitor_t _last    = {};
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void sample() {
+    lv_mem_monitor(&_last);
+    HeapHour& h = _hours[_hour];
+    if (_samples == 0) {
+        h.biggestMin = _last.free_biggest_size;
+        h.fragMax    = _last.frag_pct;
+        if (_hourCount < LVGL_HEAP_HOURS) _hourCount++;
+    } else {
+        h.biggestMin = min<uint32_t>(h.biggestMin, _last.free_biggest_size);
+        h.fragMax    = max<uint8_t>(h.fragMax, _last.frag_pct);
+    }
+    if (++_samples >= 3600000UL / LVGL_HEAP_SAMPLE_MS) {
+        _samples = 0;
+        _hour    = (_hour + 1) % LVGL_HEAP_HOURS;
+    }
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void lvgl_heap_tick(unsigned long ms) {
+    if (_lastSample && ms - _lastSample < LVGL_HEAP_SAMPLE_MS) return;
+    _lastSample = ms;
+    sample();
+}
+
+uint32_t lvgl_heap_biggest_min() {
+    uint32_t m = UINT32_MAX;
+    for (int i = 0; i < _hourCount; i++) m = min(m, _hours[i].biggestMin);
+    return _hourCount ? m : 0;
+}
+
+void lvgl_heap_report() {
+    uint8_t fragMax = 0;
+    for (int i = 0; i < _hourCount; i++) fragMax = max(fragMax, _hours[i].fragMax);
+
+    ui_anim_pool_stats_t pool;
+    ui_anim_pool_get_stats(&pool);
+    Serial.printf("LVGL heap: free %lu B, biggest %lu B, frag %u%% | %uh low: biggest %lu B, frag %u%% | "
+                  "anim pool %lu/%d (peak %lu, %lu heap) %lu starts %lu reused\n",
+                  (unsigned long)_last.free_size, (unsigned long)_last.free_biggest_size, _last.frag_pct,
+                  _hourCount, (unsigned long)lvgl_heap_biggest_min(), fragMax,
+                  (unsigned long)pool.used, UI_ANIM_POOL_SIZE, (unsigned long)pool.peak,
+                  (unsigned long)pool.heap_fallbacks, (unsigned long)pool.starts, (unsigned long)pool.reused);
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+// ─── LVGL heap monitor ──────────────────────────────────────
+// Samples the LVGL pool (LV_MEM_SIZE) every minute. The largest free block
+// is the number that matters for fragmentation: a screen built on demand
+// needs contiguous blocks, and a pool with plenty of free bytes can still
+// fail them. The lowest largest-block and highest fragmentation of each
+// hour are kept for the last 24 h.
+#define LVGL_HEAP_SAMPLE_MS   60000UL
+#define LVGL_HEAP_HOURS       24
+
+// ─── Public API ─────────────────────────────────────────────
+void     lvgl_heap_tick(unsigned long ms);
+uint32_t lvgl_heap_biggest_min();      // lowest largest-free-block over the window
+void     lvgl_heap_report();
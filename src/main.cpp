@@ -4,39 +4,73 @@
 #include "ui/ui.h"
 #include <WiFi.h>
 #include <time.h>
-#include <HTTPClient.h>
-#include <ArduinoJson.h>
 #include "credentials.h"
 #include <Wire.h>
 #include <RTClib.h>
 #include <Adafruit_SHT31.h>
 #include "word_clock.h"
 #include "word_clock_anim.h"
+#include "word_face.h"
+#include "boot_profile.h"
+#include "ntp_sync.h"
+#include "tz.h"
+#include "weather_theme.h"
+#include "aqi.h"
+#include "wifi_manager.h"
+#include "radio_power.h"
+#include "cpu_power.h"
+#include "weather_client.h"
+#include "forecast.h"
+#include "solar.h"
+#include "i2c_bus.h"
+#include "rtc_sqw.h"
+#include "history.h"
+#include "history_screen.h"
+#include "time_digits.h"
+#include "screen_transition.h"
+#include "lvgl_heap.h"
+#include "clock_source.h"
+#include "led_trace.h"
+#include "led_output.h"
+#include "ui_anim_pool.h"
+#include <esp_timer.h>
 
 // ========== WIFI CREDENTIALS ==========
 const char* ssid     = WIFI_SSID;
 const char* password = WIFI_PASSWORD;
+#define RADIO_POWER_POLICY  RADIO_POLICY_MODEM_SLEEP   // see radio_power.h
 
 
 // ========== NTP SETTINGS ==========
-const char* ntpServer         = "pool.ntp.org";
-const long  gmtOffset_sec     = 19800;
-const int   daylightOffset_sec = 0;
+const char* ntpServer = "pool.ntp.org";
+#ifndef CLOCK_TIMEZONE
+#define CLOCK_TIMEZONE "Asia/Kolkata"   // any zone from the table in tz.cpp
+#endif
+#ifndef SOLAR_LAT
+#define SOLAR_LAT 30.38                 // degrees north, for sunrise/sunset (Ambala)
+#endif
+#ifndef SOLAR_LON
+#define SOLAR_LON 76.78                 // degrees east
+#endif
 
 
 RTC_DS3231     rtc;
 Adafruit_SHT31 sht30 = Adafruit_SHT31(&Wire);
 bool rtc_ok = false;
 bool sht_ok = false;
+bool sqw_ok = false;
 unsigned long lastClockUpdate = 0;
 
 
 // ============= Weather Settings =============
 String api_key          = WEATHER_API_KEY;
 String weather_location = WEATHER_LOCATION;
-int   is_day    = 1;
-int   aqi_india = 0;
-float aqi_pm25  = 0.0;
+#ifndef WEATHER_BASE_URL
+#define WEATHER_BASE_URL NULL       // provider default; set to e.g. "http://192.168.1.10:8080" for tools/weather_replay.py
+#endif
+int       is_day     = 1;
+int       aqi_india  = 0;
+AqiResult aqi_result = { AQI_MISSING, { AQI_MISSING, AQI_MISSING, AQI_MISSING, AQI_MISSING, AQI_MISSING, AQI_MISSING }, AQI_PM25, false };
 
 
 // ============= LDR Settings =============
@@ -48,6 +82,14 @@ float aqi_pm25  = 0.0;
 #define LDR_SAMPLES         10
 
 
+// ============= Boot Settings =============
+// 1 = start WiFi association first so it overlaps display/sensor init, push
+//     the Time screen before the slower peripherals and build the other
+//     screens on first use. 0 = original serial bring-up.
+#define FAST_BOOT           1
+#define BOOT_REPORT_TIMEOUT 15000
+
+
 // ================= DISPLAY =================
 class LGFX : public lgfx::LGFX_Device {
     lgfx::Panel_ST7789 _panel_instance;
@@ -80,8 +122,10 @@ public:
         }
         {
             auto cfg = _light_instance.config();
-            cfg.pin_bl = 1;
-            cfg.invert = false;
+            cfg.pin_bl      = 1;
+            cfg.invert      = false;
+            cfg.freq        = 1200;
+            cfg.pwm_channel = 0;    // LEDC timer 0, see CPU_BACKLIGHT_LEDC_TIMER
             _light_instance.config(cfg);
             _panel_instance.setLight(&_light_instance);
         }
@@ -93,186 +137,217 @@ LGFX tft;
 
 
 // ================= LVGL BUFFER =================
+// 1 = LVGL renders straight into the ST7789's big-endian RGB565 and each
+//     stripe goes out by DMA from one of two buffers while LVGL renders the
+//     next one. 0 = native RGB565, byte-swapped by the CPU in pushPixels.
+#define DISPLAY_SWAPPED_DMA 1
+#define DISPLAY_BUF_LINES   30          // per buffer; 2 × 30 lines = the old single 40-line lv_color_t buffer
+
 static const uint16_t screenWidth  = 320;
 static const uint16_t screenHeight = 240;
-static lv_color_t     buf[screenWidth * 40];
+static uint16_t       buf1[screenWidth * DISPLAY_BUF_LINES] __attribute__((aligned(4)));
+#if DISPLAY_SWAPPED_DMA
+static uint16_t       buf2[screenWidth * DISPLAY_BUF_LINES] __attribute__((aligned(4)));
+#endif
 static lv_display_t  *disp;
 static int            current_screen = 0;
 
+struct FlushStats {
+    uint32_t areas;
+    uint32_t pixels;
+    uint64_t cpu_us;        // time spent inside the flush callback
+    uint32_t cpuMax_us;
+    uint64_t wait_us;       // part of it spent waiting for the previous DMA
+};
+static FlushStats flush_stats = {};
+
 
 void my_disp_flush(lv_display_t *disp_drv, const lv_area_t *area, uint8_t *color_p) {
+    int64_t start = esp_timer_get_time();
     uint32_t w = area->x2 - area->x1 + 1;
     uint32_t h = area->y2 - area->y1 + 1;
+    bool last  = lv_display_flush_is_last(disp_drv);
+#if DISPLAY_SWAPPED_DMA
+    // The other buffer may still be on the bus; LVGL won't touch it again
+    // until this one is handed back, so only the bus needs waiting for.
+    if (tft.getStartCount() == 0) tft.startWrite();
+    int64_t wait = esp_timer_get_time();
+    tft.waitDMA();
+    flush_stats.wait_us += esp_timer_get_time() - wait;
+    tft.pushImageDMA(area->x1, area->y1, w, h, (const lgfx::swap565_t *)color_p);
+    if (last) {
+        tft.waitDMA();      // release the bus between frames so light sleep finds it idle
+        tft.endWrite();
+    }
+#else
     tft.startWrite();
     tft.setAddrWindow(area->x1, area->y1, w, h);
     tft.pushPixels((uint16_t *)color_p, w * h);
     tft.endWrite();
+#endif
+    uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+    flush_stats.areas++;
+    flush_stats.pixels   += w * h;
+    flush_stats.cpu_us   += us;
+    flush_stats.cpuMax_us = max(flush_stats.cpuMax_us, us);
+    if (last) boot_mark("first_frame");
     lv_display_flush_ready(disp_drv);
 }
 
 
+static void flush_report() {
+    if (!flush_stats.areas) return;
+    Serial.printf("Flush: %s | %lu areas %lu px | cpu avg %lu us max %lu us | %.2f us/kpx | DMA wait %lu us\n",
+                  DISPLAY_SWAPPED_DMA ? "RGB565_SWAPPED DMA" : "RGB565 swap",
+                  (unsigned long)flush_stats.areas, (unsigned long)flush_stats.pixels,
+                  (unsigned long)(flush_stats.cpu_us / flush_stats.areas), (unsigned long)flush_stats.cpuMax_us,
+                  1000.0f * (float)flush_stats.cpu_us / (float)flush_stats.pixels,
+                  (unsigned long)flush_stats.wait_us);
+    flush_stats = {};
+}
+
+
 // ========================================================= CLOCK ================================================
 unsigned long last_tick = 0;
-static char hours_buf[3]   = {0};
-static char minutes_buf[3] = {0};
 
 
-void update_clock() {
-    if (current_screen != 0) return;
-    int h, m;
-    if (rtc_ok) {
-        DateTime rtcNow = rtc.now();
-        h = rtcNow.hour();
-        m = rtcNow.minute();
-    } else {
-        time_t t;
-        struct tm timeinfo;
-        time(&t);
-        localtime_r(&t, &timeinfo);
-        h = timeinfo.tm_hour;
-        m = timeinfo.tm_min;
-    }
-    snprintf(hours_buf,   sizeof(hours_buf),   "%02d", h);
-    snprintf(minutes_buf, sizeof(minutes_buf), "%02d", m);
-    if (ui_LabelHour)    lv_label_set_text(ui_LabelHour,    hours_buf);
-    if (ui_LabelMinutes) lv_label_set_text(ui_LabelMinutes, minutes_buf);
+// RTC and system clock both hold UTC; this is the single place local time is made.
+// Last RTC reading from the I2C task, advanced with millis() in between so
+// reading the time never touches the bus.
+// With the SQW interrupt running the software clock is used instead and the
+// RTC is only read to resync it.
+static uint32_t      rtc_epoch    = 0;
+static unsigned long rtc_epoch_ms = 0;
+static uint32_t      rtc_req_tick = 0;     // sqw_ticks() when the read was queued
+
+static void on_rtc_read(bool ok, uint32_t unixtime) {
+    if (!ok) return;
+    rtc_epoch    = unixtime;
+    rtc_epoch_ms = millis();
+    if (sqw_ok) sqw_resync(unixtime, rtc_req_tick);
 }
 
 
-// ========== WEATHER ==========
-static char weather_temp[8]     = "--";
-static char weather_humidity[8] = "--";
-int         weather_code        = 0;
-
-
-int calculate_india_aqi(float pm25) {
-    if (pm25 <= 30)  return (pm25 * 50) / 30;
-    else if (pm25 <= 60)  return 50  + ((pm25 - 30)  * 50)  / 30;
-    else if (pm25 <= 90)  return 100 + ((pm25 - 60)  * 100) / 30;
-    else if (pm25 <= 120) return 200 + ((pm25 - 90)  * 100) / 30;
-    else if (pm25 <= 250) return 300 + ((pm25 - 120) * 100) / 130;
-    else                  return 400 + ((pm25 - 250) * 100) / 130;
+static void request_rtc_read() {
+    if (!rtc_ok) return;
+    rtc_req_tick = sqw_ticks();
+    i2c_bus_read_rtc(on_rtc_read);
 }
 
 
-void fetch_weather() {
-    if (WiFi.status() != WL_CONNECTED) { Serial.println("✗ WiFi not ready"); return; }
-    HTTPClient http;
-    char url[200];
-    snprintf(url, sizeof(url),
-             "http://api.weatherapi.com/v1/current.json?key=%s&q=Ambala,Haryana,India&aqi=yes",
-             api_key.c_str());
-    Serial.println("→ HTTP GET starting...");
-    http.setTimeout(5000);
-    http.begin(url);
-    unsigned long start = millis();
-    int httpCode = http.GET();
-    Serial.printf("← HTTP response: %d (%lums)\n", httpCode, millis() - start);
-    if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        static JsonDocument doc;
-        doc.clear();
-        DeserializationError error = deserializeJson(doc, payload);
-        if (!error) {
-            float temp     = doc["current"]["temp_c"].as<float>();
-            float humidity = doc["current"]["humidity"].as<float>();
-            snprintf(weather_temp,     sizeof(weather_temp),     "%.1f", temp);
-            snprintf(weather_humidity, sizeof(weather_humidity), "%d",   (int)humidity);
-            weather_code = doc["current"]["condition"]["code"];
-            is_day       = doc["current"]["is_day"];
-            Serial.printf("Weather: %s°C, %s%%, Code: %d\n", weather_temp, weather_humidity, weather_code);
-        } else {
-            Serial.printf("✗ JSON error: %s\n", error.c_str());
-        }
-        if (doc["current"]["air_quality"]["pm2_5"]) {
-            aqi_pm25  = doc["current"]["air_quality"]["pm2_5"];
-            aqi_india = calculate_india_aqi(aqi_pm25);
-            Serial.printf("AQI: %d\n", aqi_india);
-        }
-        Serial.println("✓ Weather parsed");
+bool get_utc_time(time_t* out) {
+    if (clock_simulated()) {
+        *out = clock_utc();
+    } else if (sqw_active()) {
+        *out = sqw_now();
+    } else if (rtc_ok && rtc_epoch) {
+        *out = (time_t)(rtc_epoch + (millis() - rtc_epoch_ms) / 1000);
     } else {
-        Serial.printf("✗ HTTP failed: %d\n", httpCode);
+        if (!ntp_sync_valid()) return false;
+        time(out);
     }
-    http.end();
+    return true;
 }
 
 
-const char* get_weather_description(int code) {
-    if (code == 1000)                                    return "Clear";
-    if (code >= 1003 && code <= 1009)                    return "Cloudy";
-    if (code >= 1063 && code <= 1246)                    return "Rainy";
-    if (code == 1030 || code == 1135 || code == 1147)    return "Foggy";
-    if (code >= 1066 && code <= 1258)                    return "Snowy";
-    if (code == 1087 || code >= 1273)                    return "Stormy";
-    return "Clear";
+bool get_local_time(struct tm* out) {
+    time_t utc;
+    if (!get_utc_time(&utc)) return false;
+    tz_localtime(utc, out);
+    return true;
 }
 
 
-void show_weather_icon() {
-    if (ui_SunIcon)         lv_obj_add_flag(ui_SunIcon,         LV_OBJ_FLAG_HIDDEN);
-    if (ui_MoonIcon)        lv_obj_add_flag(ui_MoonIcon,        LV_OBJ_FLAG_HIDDEN);
-    if (ui_CloudIcon)       lv_obj_add_flag(ui_CloudIcon,       LV_OBJ_FLAG_HIDDEN);
-    if (ui_RainIcon)        lv_obj_add_flag(ui_RainIcon,        LV_OBJ_FLAG_HIDDEN);
-    if (ui_FogIcon)         lv_obj_add_flag(ui_FogIcon,         LV_OBJ_FLAG_HIDDEN);
-    if (ui_CloudyNightIcon) lv_obj_add_flag(ui_CloudyNightIcon, LV_OBJ_FLAG_HIDDEN);
-    if (ui_SunIcon)         lv_anim_del(ui_SunIcon, NULL);
-
-    if (weather_code == 1000) {
-        if (is_day == 1) {
-            if (ui_SunIcon) { lv_obj_clear_flag(ui_SunIcon, LV_OBJ_FLAG_HIDDEN); RotatingSun_Animation(ui_SunIcon, 0); }
-        } else {
-            if (ui_MoonIcon) lv_obj_clear_flag(ui_MoonIcon, LV_OBJ_FLAG_HIDDEN);
-        }
-    } else if (weather_code >= 1003 && weather_code <= 1009) {
-        if (is_day == 1) {
-            if (ui_CloudIcon) lv_obj_clear_flag(ui_CloudIcon, LV_OBJ_FLAG_HIDDEN);
-        } else {
-            if (ui_CloudyNightIcon) lv_obj_clear_flag(ui_CloudyNightIcon, LV_OBJ_FLAG_HIDDEN);
-        }
-    } else if (weather_code >= 1063 && weather_code <= 1246) {
-        if (ui_RainIcon) lv_obj_clear_flag(ui_RainIcon, LV_OBJ_FLAG_HIDDEN);
-    } else if (weather_code == 1030 || weather_code == 1135 || weather_code == 1147) {
-        if (ui_FogIcon) lv_obj_clear_flag(ui_FogIcon, LV_OBJ_FLAG_HIDDEN);
+// Once per local day: sunrise/sunset for the word clock schedule. is_day
+// follows the sun from then on rather than the last weather response.
+void update_sun(time_t utc) {
+    if (solar_update(utc)) {
+        const SolarDay& sun = solar_today();
+        if (sun.polar) wordclock_set_sun(-1, -1);
+        else           wordclock_set_sun(solar_local_minutes(sun.sunrise), solar_local_minutes(sun.sunset));
     }
+    is_day = solar_is_day(utc);
 }
 
 
-void set_weather_background() {
-    if (weather_code == 1000) {
-        lv_obj_set_style_bg_color(ui_Outdoor_Weather,
-            is_day ? lv_color_hex(0x87CEEB) : lv_color_hex(0x0F1C2E), 0);
-    } else if (weather_code >= 1003 && weather_code <= 1009) {
-        lv_obj_set_style_bg_color(ui_Outdoor_Weather, lv_color_hex(0x95A5A6), 0);
-    } else if (weather_code >= 1063 && weather_code <= 1246) {
-        lv_obj_set_style_bg_color(ui_Outdoor_Weather, lv_color_hex(0x34495E), 0);
-    } else if (weather_code == 1030 || weather_code == 1135 || weather_code == 1147) {
-        lv_obj_set_style_bg_color(ui_Outdoor_Weather, lv_color_hex(0xBDC3C7), 0);
+// One blink cycle per SQW edge. The first call after the Time screen loads
+// stops the free-running Blink_Animation it starts so the two don't fight
+// over the label's opacity.
+static bool seconds_blink_owned = false;
+
+static void seconds_opa_cb(void* obj, int32_t v) { lv_obj_set_style_opa((lv_obj_t*)obj, v, 0); }
+
+void blink_second() {
+    if (!ui_LabelSeconds) return;
+    if (!seconds_blink_owned) {
+        lv_anim_delete(ui_LabelSeconds, NULL);
+        seconds_blink_owned = true;
     }
+    lv_anim_delete(ui_LabelSeconds, seconds_opa_cb);
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, ui_LabelSeconds);
+    lv_anim_set_exec_cb(&a, seconds_opa_cb);
+    lv_anim_set_values(&a, 0, 255);
+    lv_anim_set_duration(&a, 500);                 // same shape as Blink_Animation
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_in);
+    lv_anim_set_reverse_delay(&a, 250);
+    lv_anim_set_reverse_duration(&a, 250);
+    lv_anim_set_early_apply(&a, true);
+    lv_anim_start(&a);
 }
 
 
-void set_weather_text_colors() {
-    lv_color_t text_color;
-    if      (weather_code == 1000 && is_day == 1)                                  text_color = lv_color_hex(0x000000);
-    else if (weather_code == 1000 && is_day == 0)                                  text_color = lv_color_hex(0xFFFFFF);
-    else if (weather_code >= 1003 && weather_code <= 1009 && is_day == 1)          text_color = lv_color_hex(0x000000);
-    else if (weather_code >= 1003 && weather_code <= 1009 && is_day == 0)          text_color = lv_color_hex(0xFFFFFF);
-    else if (weather_code >= 1063 && weather_code <= 1246)                         text_color = lv_color_hex(0xFFFFFF);
-    else if (weather_code == 1030 || weather_code == 1135 || weather_code == 1147) text_color = lv_color_hex(0x000000);
-    else                                                                            text_color = lv_color_hex(0xFFFFFF);
+void update_clock() {
+    if (current_screen != 0) return;
+    struct tm timeinfo;
+    if (!get_local_time(&timeinfo)) return;
+    time_digits_set(timeinfo.tm_hour, timeinfo.tm_min);     // redraws only the digits that changed
+}
+
 
-    if (ui_WeatherDesc)     lv_obj_set_style_text_color(ui_WeatherDesc,     text_color, 0);
-    if (ui_OutdoorTemp)     lv_obj_set_style_text_color(ui_OutdoorTemp,     text_color, 0);
-    if (ui_Celcious)        lv_obj_set_style_text_color(ui_Celcious,        text_color, 0);
+// ========== WEATHER ==========
+static char weather_temp[8]     = "--";
+static char weather_humidity[8] = "--";
+int         weather_code        = 0;
+
+
+// Returns the delay in ms until the next fetch should run.
+unsigned long fetch_weather() {
+    static WeatherSample sample;
+    WeatherResult r = weather_client_fetch(sample);
+    unsigned long next_ms = weather_client_next_delay_ms();
+    if (r != WEATHER_OK) {
+        Serial.printf("%s Weather %s | next in %lus\n", r == WEATHER_UNCHANGED ? "=" : "✗",
+                      weather_result_name(r), next_ms / 1000);
+        return next_ms;
+    }
+
+    snprintf(weather_temp,     sizeof(weather_temp),     "%.1f", sample.temp_c);
+    snprintf(weather_humidity, sizeof(weather_humidity), "%d",   (int)sample.humidity);
+    weather_code = sample.code;
+    if (!solar_valid()) is_day = sample.is_day;   // until the clock is set
+    Serial.printf("Weather: %s°C, %s%%, Code: %d\n", weather_temp, weather_humidity, weather_code);
+
+    if (sample.has_aqi) {
+        aqi_result = aqi_compute(sample.conc);
+        if (aqi_result.aqi != AQI_MISSING) aqi_india = aqi_result.aqi;
+        Serial.printf("AQI: %d (%s, %s)%s | PM2.5 %d PM10 %d NO2 %d O3 %d SO2 %d CO %d\n",
+                      aqi_result.aqi, aqi_pollutant_name(aqi_result.dominant), aqi_category(aqi_result.aqi),
+                      aqi_result.valid ? "" : " [incomplete]",
+                      aqi_result.sub[AQI_PM25], aqi_result.sub[AQI_PM10], aqi_result.sub[AQI_NO2],
+                      aqi_result.sub[AQI_O3],   aqi_result.sub[AQI_SO2],  aqi_result.sub[AQI_CO]);
+    }
+    Serial.printf("✓ Weather parsed (%lu B) | next in %lus\n",
+                  (unsigned long)weather_client_stats().bytesLast, next_ms / 1000);
+    return next_ms;
 }
 
 
 // =================================================== Indoor Screen ===============================================
-void update_indoor_screen() {
-    if (!sht_ok) return;
-    float temp     = sht30.readTemperature();
-    float humidity = sht30.readHumidity();
-    if (isnan(temp) || isnan(humidity)) { Serial.println("✗ SHT30 read failed"); return; }
+// Runs from i2c_bus_poll() once the combined temperature/humidity measurement is in
+static void on_sht_read(bool ok, float temp, float humidity) {
+    if (!ok || isnan(temp) || isnan(humidity)) { Serial.println("✗ SHT30 read failed"); return; }
     Serial.printf("SHT30: %.1f°C, %.1f%%\n", temp, humidity);
 
     static char indoor_temp_buf[8];
@@ -314,27 +389,106 @@ void update_indoor_screen() {
 }
 
 
+void update_indoor_screen() {
+    if (sht_ok) i2c_bus_read_sht(on_sht_read);
+}
+
+
+// =================================================== History Screen ==============================================
+static void on_history_read(bool ok, float temp, float humidity) {
+    time_t utc;
+    if (!get_utc_time(&utc)) return;     // no time base, nowhere to put the sample
+    if (ok && !isnan(temp) && !isnan(humidity)) history_add(utc, temp, humidity);
+    else                                        history_add_missing(utc);
+}
+
+void sample_history() {
+    time_t utc;
+    if (sht_ok) i2c_bus_read_sht(on_history_read);
+    else if (get_utc_time(&utc)) history_add_missing(utc);
+}
+
+// One point per chart pixel at most; the store averages down to that
+static int32_t    history_temp[320];
+static int32_t    history_hum[320];
+static HistoryTier history_range = HISTORY_6H;
+static char       history_temp_buf[16] = {0};
+static char       history_hum_buf[16]  = {0};
+
+void update_history_screen() {
+    if (!ui_HistoryChart) return;
+    lv_obj_update_layout(ui_HistoryChart);
+    int width = min<int>(lv_obj_get_content_width(ui_HistoryChart), 320);
+    int n     = history_series(history_range, history_temp, history_hum, width);
+
+    int32_t lo = INT32_MAX, hi = INT32_MIN;
+    int last = -1;
+    for (int i = 0; i < n; i++) {
+        if (history_temp[i] == HISTORY_MISSING) continue;
+        lo = min(lo, history_temp[i]);
+        hi = max(hi, history_temp[i]);
+        last = i;
+    }
+    if (last < 0) { lo = 150; hi = 300; }
+    lo -= 5;                                      // half a degree of headroom, at least 2 °C of span
+    hi += 5;
+    if (hi - lo < 20) { int32_t mid = (lo + hi) / 2; lo = mid - 10; hi = mid + 10; }
+
+    lv_chart_series_t* temp_ser = lv_chart_get_series_next(ui_HistoryChart, NULL);
+    lv_chart_series_t* hum_ser  = lv_chart_get_series_next(ui_HistoryChart, temp_ser);
+    lv_chart_set_point_count(ui_HistoryChart, n);
+    lv_chart_set_ext_y_array(ui_HistoryChart, temp_ser, history_temp);
+    lv_chart_set_ext_y_array(ui_HistoryChart, hum_ser,  history_hum);
+    lv_chart_set_range(ui_HistoryChart, LV_CHART_AXIS_PRIMARY_Y, lo, hi);
+    lv_chart_refresh(ui_HistoryChart);
+
+    if (last >= 0) {
+        snprintf(history_temp_buf, sizeof(history_temp_buf), "%.1f °C", history_temp[last] / 10.0f);
+        snprintf(history_hum_buf,  sizeof(history_hum_buf),  "%ld %%RH", (long)((history_hum[last] + 5) / 10));
+    } else {
+        snprintf(history_temp_buf, sizeof(history_temp_buf), "-- °C");
+        snprintf(history_hum_buf,  sizeof(history_hum_buf),  "-- %%RH");
+    }
+    if (ui_HistoryRange)      lv_label_set_text_static(ui_HistoryRange, history_tier_name(history_range));
+    if (ui_HistoryTempLegend) lv_label_set_text_static(ui_HistoryTempLegend, history_temp_buf);
+    if (ui_HistoryHumLegend)  lv_label_set_text_static(ui_HistoryHumLegend,  history_hum_buf);
+}
+
+
 // ====================================================== SCREEN SWITCHING ======================================
+// Screens other than ui_Time are built on first use instead of in ui_init().
+static void ensure_screen(lv_obj_t** screen, void (*init)(void)) {
+    if (*screen != NULL) return;
+    unsigned long start = millis();
+    init();
+    Serial.printf("✓ Screen built on demand (%lums)\n", millis() - start);
+}
+
+// The simulated clock changes screens without a transition unless asked
+// to, see clock_source.h.
+static TransitionType lap_transition(TransitionType type) {
+    return clock_simulated() && !SIM_CLOCK_TRANSITIONS ? TRANSITION_NONE : type;
+}
+
 static char date_buf[4]     = {0};
 static char month_buf[8]    = {0};
 static char day_buf[8]      = {0};
 static char temp_buf[8]     = {0};
 static char humidity_buf[8] = {0};
 static char aqi_buf[8]      = {0};
+static char aqi_src_buf[24] = {0};
 static char desc_buf[16]    = {0};
 
 
 void switch_screen() {
     if (current_screen == 0) {
-        if (ui_Day_Date_Month == NULL) { Serial.println("! ui_Day_Date_Month NULL"); ui_init(); }
-        lv_anim_del_all();
-        lv_scr_load(ui_Day_Date_Month);
+        ensure_screen(&ui_Day_Date_Month, ui_Day_Date_Month_screen_init);
+        ui_anim_release_screen(lv_scr_act());
+        screen_transition_load(ui_Day_Date_Month, lap_transition(TRANSITION_PUSH));
         current_screen = 1;
 
-        time_t t;
-        struct tm timeinfo;
-        time(&t);
-        localtime_r(&t, &timeinfo);
+        struct tm timeinfo = {};
+        get_local_time(&timeinfo);
 
         snprintf(date_buf,  sizeof(date_buf),  "%02d", timeinfo.tm_mday);
         strftime(month_buf, sizeof(month_buf), "%b",   &timeinfo);
@@ -349,35 +503,39 @@ void switch_screen() {
         Serial.println("✓ Loaded Date Screen");
 
     } else if (current_screen == 1) {
-        if (ui_Indoor_Weather == NULL) { Serial.println("! ui_Indoor_Weather NULL"); ui_init(); }
-        lv_anim_del(lv_scr_act(), NULL);
-        lv_scr_load(ui_Indoor_Weather);
+        ensure_screen(&ui_Indoor_Weather, ui_Indoor_Weather_screen_init);
+        ui_anim_release_screen(lv_scr_act());
+        screen_transition_load(ui_Indoor_Weather, lap_transition(TRANSITION_PUSH));
         current_screen = 2;
         update_indoor_screen();
         Serial.println("✓ Loaded Indoor Screen");
 
     } else if (current_screen == 2) {
-        if (ui_Outdoor_Weather == NULL) { Serial.println("! ui_Outdoor_Weather NULL"); ui_init(); }
-        lv_anim_del_all();
-        lv_scr_load(ui_Outdoor_Weather);
+        ensure_screen(&ui_Outdoor_Weather, ui_Outdoor_Weather_screen_init);
+        ui_anim_release_screen(lv_scr_act());
+        screen_transition_load(ui_Outdoor_Weather, lap_transition(TRANSITION_PUSH));
         current_screen = 3;
 
         snprintf(temp_buf,     sizeof(temp_buf),     "%s", weather_temp);
         snprintf(humidity_buf, sizeof(humidity_buf), "%s", weather_humidity);
-        snprintf(desc_buf,     sizeof(desc_buf),     "%s", get_weather_description(weather_code));
+        snprintf(desc_buf,     sizeof(desc_buf),     "%s", weather_theme(weather_code, is_day).description);
+
+        // Dry now but rain due soon: the forecast is more useful than "Sunny"
+        int rain_in = forecast_next_rain_hours();
+        WeatherCategory wx = weather_category(weather_code);
+        if (rain_in > 0 && rain_in <= 12 && wx != WX_RAIN && wx != WX_STORM)
+            snprintf(desc_buf, sizeof(desc_buf), "Rain in %dh", rain_in);
 
         if (ui_OutdoorTemp) lv_label_set_text_static(ui_OutdoorTemp, temp_buf);
         if (ui_WeatherDesc) lv_label_set_text_static(ui_WeatherDesc, desc_buf);
 
-        set_weather_background();
-        set_weather_text_colors();
-        show_weather_icon();
+        weather_theme_apply(weather_code, is_day);
         Serial.println("✓ Loaded Outdoor Screen");
 
     } else if (current_screen == 3) {
-        if (ui_AQIHumidity == NULL) { Serial.println("! ui_AQIHumidity NULL"); ui_init(); }
-        lv_anim_del_all();
-        lv_scr_load(ui_AQIHumidity);
+        ensure_screen(&ui_AQIHumidity, ui_AQIHumidity_screen_init);
+        ui_anim_release_screen(lv_scr_act());
+        screen_transition_load(ui_AQIHumidity, lap_transition(TRANSITION_PUSH));
         current_screen = 4;
 
         snprintf(humidity_buf, sizeof(humidity_buf), "%s", weather_humidity);
@@ -385,15 +543,35 @@ void switch_screen() {
 
         if (ui_OutdoorHumidity) lv_label_set_text_static(ui_OutdoorHumidity, humidity_buf);
         if (ui_AQI)             lv_label_set_text_static(ui_AQI,             aqi_buf);
+
+        if (aqi_result.aqi != AQI_MISSING)
+            snprintf(aqi_src_buf, sizeof(aqi_src_buf), "%s - %s",
+                     aqi_pollutant_name(aqi_result.dominant), aqi_category(aqi_result.aqi));
+        else
+            snprintf(aqi_src_buf, sizeof(aqi_src_buf), "--");
+        if (ui_AQIPollutant)    lv_label_set_text_static(ui_AQIPollutant,    aqi_src_buf);
         Serial.println("✓ Loaded AQI Screen");
 
+    } else if (current_screen == 4) {
+        ensure_screen(&ui_History, history_screen_init);
+        ui_anim_release_screen(lv_scr_act());
+        screen_transition_load(ui_History, lap_transition(TRANSITION_PUSH));
+        current_screen = 5;
+
+        update_history_screen();
+        Serial.printf("✓ Loaded History Screen (%s)\n", history_tier_name(history_range));
+        history_range = (HistoryTier)((history_range + 1) % HISTORY_TIER_COUNT);   // next lap shows the next range
+
     } else {
-        if (ui_Time == NULL) { Serial.println("! ui_Time NULL"); ui_init(); }
-        lv_anim_del_all();
-        lv_scr_load(ui_Time);
+        ensure_screen(&ui_Time, ui_Time_screen_init);
+        ui_anim_release_screen(lv_scr_act());
+        screen_transition_load(ui_Time, lap_transition(TRANSITION_FADE));    // back to the start of the lap
+        seconds_blink_owned = false;    // the load event restarted Blink_Animation
         current_screen = 0;
+        update_clock();                 // digits are current before the fade-in
         Serial.println("✓ Loaded Time Screen");
     }
+    screen_transition_play();      // labels above are set before anything is drawn
 }
 
 
@@ -410,15 +588,45 @@ int read_brightness() {
 
 
 // ====================================================== SETUP ==================================================
+static void start_wifi() {
+    Serial.println(">>> Starting WiFi...");
+    radio_power_begin(RADIO_POWER_POLICY);
+    wifi_mgr_begin(ssid, password);
+    weather_client_begin(&weatherapi_provider, &weather_http_transport,
+                         WEATHER_BASE_URL, api_key.c_str(), weather_location.c_str());
+    forecast_begin(WEATHER_BASE_URL, api_key.c_str(), weather_location.c_str());
+    boot_mark("wifi_begin");
+}
+
+
+// Same theme setup as ui_init(), but only the Time screen is built up front.
+static void ui_init_time_screen() {
+    lv_display_t* dispp = lv_display_get_default();
+    lv_theme_t*   theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
+                                                false, LV_FONT_DEFAULT);
+    lv_display_set_theme(dispp, theme);
+    ui_Time_screen_init();
+}
+
+
 void setup() {
+    boot_mark("setup");
+    clock_begin();
     Serial.begin(115200);
+#if !FAST_BOOT
     delay(1000);
+#endif
     Serial.println(">>> System Booting...");
 
+#if FAST_BOOT
+    if (!clock_simulated()) start_wifi();   // association runs in the background while the rest comes up
+#endif
+
     tft.init();
     tft.setRotation(1);
     tft.setBrightness(255);
     Serial.println("✓ TFT Initialized");
+    boot_mark("tft");
 
     lv_init();
     Serial.println("✓ LVGL Initialized");
@@ -427,25 +635,55 @@ void setup() {
     if (disp == NULL) { Serial.println("❌ Failed to create display!"); while(1); }
 
     lv_display_set_flush_cb(disp, my_disp_flush);
-    lv_display_set_buffers(disp, buf, NULL, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+#if DISPLAY_SWAPPED_DMA
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED);
+    lv_display_set_buffers(disp, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+#else
+    lv_display_set_buffers(disp, buf1, NULL, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+#endif
     lv_display_set_user_data(disp, &tft);
+    boot_mark("lvgl");
 
+#if FAST_BOOT
+    ui_init_time_screen();
+#else
     ui_init();
+#endif
+    if (ui_Time == NULL) { Serial.println("❌ CRITICAL: ui_Time NULL!"); while(1); }
+    time_digits_begin(disp, ui_LabelHour, ui_LabelMinutes);
+    Serial.println("✓ UI Initialized Successfully");
+    boot_mark("ui");
 
-    wordclock_init();
-    Serial.println("✓ Word Clock Initialized");
-    currentAnimation = ANIM_TYPEWRITER;   // change to any ANIM_* value
-    animationSpeed   = 1.0f;
-
-    Wire.begin(8, 9);
+    i2c_bus_begin(8, 9);
 
     if (!rtc.begin(&Wire)) {
         Serial.println("✗ DS3231 not found — falling back to NTP only");
         rtc_ok = false;
     } else {
         rtc_ok = true;
+        on_rtc_read(true, rtc.now().unixtime());   // seed; the I2C task keeps it fresh from here
         Serial.println("✓ DS3231 initialized");
+        sqw_ok = sqw_begin(&rtc, SQW_PIN);
     }
+    if (!tz_set(CLOCK_TIMEZONE)) Serial.printf("✗ Unknown timezone %s — using UTC\n", CLOCK_TIMEZONE);
+    solar_set_location(SOLAR_LAT, SOLAR_LON);
+    ntp_sync_begin(&rtc, rtc_ok, ntpServer);
+    boot_mark("rtc");
+
+    lv_scr_load(ui_Time);
+    screen_transition_begin(&tft, disp);
+#if FAST_BOOT
+    update_clock();
+    lv_refr_now(disp);   // first frame goes out before LEDs and SHT30 are touched
+#endif
+
+    wordclock_init();
+    Serial.printf("✓ Word Clock Initialized (%s face)\n", face_name());
+    currentAnimation = ANIM_TYPEWRITER;   // change to any ANIM_* value
+    animationSpeed   = clock_simulated() ? 100.0f : 1.0f;   // transitions run at show() speed in simulation
+    animationEnabled = !clock_simulated() || SIM_CLOCK_TRANSITIONS;
+    if (clock_simulated() && !animationSeed) animationSeed = SIM_CLOCK_START_UTC;   // same frames every run
+    boot_mark("leds");
 
     if (!sht30.begin(0x44)) {
         Serial.println("✗ SHT30 not found");
@@ -454,25 +692,24 @@ void setup() {
         sht_ok = true;
         Serial.println("✓ SHT30 initialized");
     }
+    i2c_bus_attach(rtc_ok ? &rtc : NULL, sht_ok ? &sht30 : NULL);
+    boot_mark("sht30");
 
-    if (ui_Time == NULL) { Serial.println("❌ CRITICAL: ui_Time NULL!"); while(1); }
-    Serial.println("✓ UI Initialized Successfully");
+    history_begin();
 
-    lv_scr_load(ui_Time);
+    // LVGL reads esp_timer directly instead of a 5 ms periodic callback, which
+    // would wake the chip out of light sleep 200 times a second. esp_timer is
+    // compensated across light sleep, so the tick stays correct.
+    lv_tick_set_cb([]() -> uint32_t { return (uint32_t)(esp_timer_get_time() / 1000); });
+    Serial.println("✓ LVGL Tick Source Set");
 
-    const esp_timer_create_args_t lvgl_tick_timer_args = {
-        .callback = [](void*){ lv_tick_inc(5); },
-        .name = "lvgl_tick"
-    };
-    esp_timer_handle_t lvgl_tick_timer = NULL;
-    esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer);
-    esp_timer_start_periodic(lvgl_tick_timer, 5000);
-    Serial.println("✓ Hardware Timer Started");
+    cpu_power_begin(disp);
 
-    Serial.println(">>> Starting WiFi...");
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
+#if !FAST_BOOT
+    if (!clock_simulated()) start_wifi();
+#endif
 
+    boot_mark("setup_done");
     Serial.printf("Free heap: %d\n", ESP.getFreeHeap());
 }
 
@@ -480,84 +717,162 @@ void setup() {
 
 void loop() {
     static unsigned long last_screen_switch = 0;
-    static unsigned long last_weather_fetch = 0;
+    static unsigned long last_screen_real   = 0;     // real time of the last switch, for the simulated clock
+    static unsigned long next_weather_fetch = 0;
+    static unsigned long next_forecast      = 0;
     static unsigned long last_ldr           = 0;
-    static bool          wifi_connected     = false;
+    static unsigned long last_history       = 0;
+    static bool          network_resync     = false;
     static unsigned long last_debug         = 0;
+    static unsigned long last_wifi_report   = 0;
+    static bool          boot_reported      = false;
 
     lv_timer_handler();
+    cpu_power_loop();
+    i2c_bus_poll();
+
+    clock_sim_job_begin(SIM_JOB_LOOP);
+    unsigned long ms = clock_ms();          // scheduling time, virtual in simulation
+    unsigned long real_ms = millis();       // reporting and flash wear stay on real time
 
-    unsigned long ms = millis();
+    if (!boot_reported && (boot_has_mark("wifi_up") || real_ms >= BOOT_REPORT_TIMEOUT)) {
+        boot_reported = true;
+        boot_report();
+    }
 
-    if (ms - last_debug >= 5000) {
-        last_debug = ms;
+    if (real_ms - last_debug >= 5000) {
+        last_debug = real_ms;
         Serial.printf("Heap: %d | Screen: %d\n", ESP.getFreeHeap(), current_screen);
+        if (real_ms - last_wifi_report >= 60000) {
+            last_wifi_report = real_ms;
+            wifi_mgr_report();
+            radio_power_report();
+            cpu_power_report();
+            weather_client_report();
+            forecast_report();
+            i2c_bus_report();
+            if (sqw_ok) sqw_report();
+            history_report();
+            time_digits_report();
+            flush_report();
+            screen_transition_report();
+            lvgl_heap_report();
+            led_trace_report();
+            led_output_report();
+        }
     }
 
     // ────────────────────────── Word Clock ──────────────────────────────────────────
     wordclock_tick();
 
     if (lastClockUpdate == 0 || ms - lastClockUpdate >= 60000) {
-        lastClockUpdate = ms;
-        if (rtc_ok) {
-            DateTime rtcNow = rtc.now();
-            wordclock_update(rtcNow.hour(), rtcNow.minute());
-        } else {
+        // A loop pass is several virtual seconds in simulation: stay on the
+        // minute grid so the lag doesn't add up to skipped minutes (0 = redraw)
+        lastClockUpdate = clock_simulated() ? max(ms - ms % 60000, 1UL) : ms;
+        time_t utc;
+        if (get_utc_time(&utc)) {
+            update_sun(utc);
             struct tm timeinfo;
-            if (getLocalTime(&timeinfo)) {
-                wordclock_update(timeinfo.tm_hour, timeinfo.tm_min);
-            }
+            tz_localtime(utc, &timeinfo);
+            cpu_power_led_busy(true);
+            char trace_label[8];
+            snprintf(trace_label, sizeof(trace_label), "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+            led_trace_begin(trace_label);
+            clock_sim_job_begin(SIM_JOB_WORDCLOCK);
+            wordclock_update(timeinfo.tm_hour, timeinfo.tm_min);
+            clock_sim_job_end(SIM_JOB_WORDCLOCK);
+            led_trace_end();
+            clock_sim_frame("leds", (const uint8_t*)leds, sizeof(leds));
+            led_output_wait();      // the last frame is still going out on the output task
+            cpu_power_led_busy(false);
         }
     }
 
     // ────────────────────────── WiFi & NTP ──────────────────────────────────────────
-    if (!wifi_connected && WiFi.status() == WL_CONNECTED) {
-        wifi_connected = true;
-        Serial.printf("✓ WiFi Connected | IP: %s\n", WiFi.localIP().toString().c_str());
-        configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
-        struct tm timeinfo;
-        int attempts = 0;
-        while (!getLocalTime(&timeinfo) && attempts < 10) { delay(100); attempts++; }
-
-        if (rtc_ok) {
-            time_t epoch;
-            time(&epoch);
-            epoch += gmtOffset_sec;
-            rtc.adjust(DateTime((uint32_t)epoch));
-            Serial.println("✓ DS3231 synced with NTP");
-        }
+    wifi_mgr_tick();
 
-        last_weather_fetch = ms;
-        fetch_weather();
+    if (wifi_mgr_take_link_up()) {
+        boot_mark("wifi_up");
+        Serial.printf("✓ WiFi Connected | IP: %s | RSSI %d\n", WiFi.localIP().toString().c_str(), WiFi.RSSI());
+        network_resync = true;   // every (re)connect re-runs NTP and weather once the link settles
+        radio_power_link_up();
     }
 
-    if (wifi_connected && ms - last_weather_fetch >= 600000) {
-        last_weather_fetch = ms;
-        fetch_weather();
+    if (network_resync && wifi_mgr_stable()) {
+        network_resync = false;
+        radio_power_job_started();
+        ntp_sync_start();   // SNTP completes in the background, see ntp_sync_tick()
+        next_weather_fetch = ms + fetch_weather();
+        radio_power_job_done();
     }
 
+    if (ntp_sync_tick()) {
+        lastClockUpdate = 0;    // redraw the word clock with the corrected time
+        request_rtc_read();     // the RTC was rewritten, resync the SQW clock
+    }
+
+    if (!network_resync && wifi_mgr_stable() && (long)(ms - next_weather_fetch) >= 0) {
+        radio_power_job_started();
+        next_weather_fetch = ms + fetch_weather();
+        radio_power_job_done();
+    }
+
+    // Low cadence and independent of reconnects, so duty-cycled wake-ups don't refetch it
+    if (!network_resync && wifi_mgr_stable() && (long)(ms - next_forecast) >= 0) {
+        radio_power_job_started();
+        next_forecast = ms + (forecast_fetch() ? FORECAST_INTERVAL_MS : FORECAST_RETRY_MS);
+        radio_power_job_done();
+    }
+
+    radio_power_tick((long)(next_forecast - next_weather_fetch) < 0 ? next_forecast : next_weather_fetch);
+
+    // ────────────────────────── Climate History ─────────────────────────────────────
+    if (ms - last_history >= HISTORY_SAMPLE_MS) {
+        last_history = ms;
+        sample_history();
+    }
+    history_tick(real_ms);
+    lvgl_heap_tick(real_ms);
+
     // ────────────────────────── LDR Brightness ──────────────────────────────────────
     if (ms - last_ldr >= 1000) {
         last_ldr = ms;
         int raw            = read_brightness();
         int lcd_brightness = map(raw, 0, 4095, MIN_LCD_BRIGHTNESS, MAX_LCD_BRIGHTNESS);
         int led_brightness = map(raw, 0, 4095, MIN_LED_BRIGHTNESS,  MAX_LED_BRIGHTNESS);
-        tft.setBrightness(lcd_brightness);
+        screen_transition_set_brightness(lcd_brightness);
         //FastLED.setBrightness(led_brightness);
     }
 
     // ────────────────────────── LCD Clock Update ────────────────────────────────────
-    if (ms - last_tick >= 1000) {
+    if (!clock_simulated() && sqw_take_tick()) {
+        // Right after the RTC's own seconds edge: the blink restarts in phase
         last_tick = ms;
+        if (sqw_resync_due()) request_rtc_read();
         update_clock();
+        if (current_screen == 0) blink_second();
+    } else if ((clock_simulated() || !sqw_active()) && ms - last_tick >= 1000) {
+        last_tick = ms;
+        request_rtc_read();     // lands on a later loop, the clock uses the cached value
+        update_clock();
+        if (seconds_blink_owned && current_screen == 0) {
+            seconds_blink_owned = false;            // no SQW: back to the free-running blink
+            Blink_Animation(ui_LabelSeconds, 0);
+        }
     }
 
     //───────────────────────── Screen Carousel ─────────────────────────────────────
-    if (ms - last_screen_switch >= 7000) {
+    if (ms - last_screen_switch >= 7000 &&
+        (!clock_simulated() || real_ms - last_screen_real >= SIM_CAROUSEL_REAL_MS)) {
         last_screen_switch = ms;
+        last_screen_real   = real_ms;
         Serial.printf("→ Screen %d\n", current_screen + 1);
+        clock_sim_job_begin(SIM_JOB_SCREEN);
         switch_screen();
+        clock_sim_job_end(SIM_JOB_SCREEN);
     }
 
+    clock_sim_job_end(SIM_JOB_LOOP);
+    clock_sim_tick();
     delay(5);
 }
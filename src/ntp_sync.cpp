@@ -0,0 +1,349 @@
+#include "ntp_sync.h"
+#include "i2c_bus.h"
+#include "rtc_sqw.h"
+#include <esp_pm.h>
+#include <esp_timer.h>
+#include <Wire.h>
+#include <time.h>
+#include <sys/time.h>
+#include "esp_sntp.h"
+
+#define DS3231_ADDR      0x68
+#define DS3231_REG_CTRL  0x0E
+#define DS3231_REG_AGING 0x10
+#define DS3231_CTRL_CONV 0x20
+
+#define WRITE_SLACK_US   100        // the write timer fires just after the system second, not a hair before
+
+enum SyncState {
+    SYNC_IDLE,
+    SYNC_FIND_RTC_EDGE,     // learn the RTC's second phase (SQW edge, or polling once per loop)
+    SYNC_CATCH_RTC_EDGE,    // no SQW: busy-poll the RTC across the next expected rollover
+    SYNC_WAIT_SYS_EDGE,     // arm the write for the next system-second boundary
+    SYNC_WRITING            // write timer armed
+};
+
+static RTC_DS3231*   _rtc        = nullptr;
+static bool          _rtcOk      = false;
+static const char*   _server     = nullptr;
+
+static volatile bool _syncPending = false;
+static bool          _valid       = false;
+static SyncState     _state       = SYNC_IDLE;
+static uint8_t       _edgeSecond  = 0;
+static unsigned long _edgeStart   = 0;
+static uint32_t      _edgeTick    = 0;     // sqw_ticks() when the search started
+static int64_t       _lastPoll_us = 0;     // last poll that still saw _edgeSecond
+static int64_t       _catchFrom_us = 0;    // busy-poll window for the next rollover
+static int64_t       _catchTo_us  = 0;
+static uint8_t       _edgeTries   = 0;
+static time_t        _lastAdjust  = 0;     // UTC second the RTC was last written
+
+static esp_timer_handle_t   _writeTimer = NULL;
+static esp_pm_lock_handle_t _pmLock     = NULL;
+static volatile time_t      _written    = 0;   // set by the write timer
+static volatile bool        _writeLate  = false;
+
+static NtpSyncStats  _stats = { 0, 0, NAN, 0, NTP_RESYNC_MIN_S };
+
+// ─── DS3231 aging register ──────────────────────────────────
+static int8_t readAging() {
+    i2c_bus_lock();
+    int8_t value = 0;
+    Wire.beginTransmission(DS3231_ADDR);
+    Wire.write(DS3231_REG_AGING);
+    if (Wire.endTransmission() == 0 && Wire.requestFrom(DS3231_ADDR, 1) == 1) value = (int8_t)Wire.read();
+    i2c_bus_unlock();
+    return value;
+}
+
+static void writeAging(int8_t value) {
+    i2c_bus_lock();
+    Wire.beginTransmission(DS3231_ADDR);
+    Wire.write(DS3231_REG_AGING);
+    Wire.write((uint8_t)value);
+    Wire.endTransmission();
+
+    // Force a TCXO conversion so the new offset applies now instead of in 64 s
+    Wire.beginTransmission(DS3231_ADDR);
+    Wire.write(DS3231_REG_CTRL);
+    Wire.endTransmission();
+    if (Wire.requestFrom(DS3231_ADDR, 1) == 1) {
+        uint8_t ctrl = Wire.read();
+        Wire.beginTransmission(DS3231_ADDR);
+        Wire.write(DS3231_REG_CTRL);
+        Wire.write(ctrl | DS3231_CTRL_CONV);
+        Wire.endTransmission();
+    }
+    i2c_bus_unlock();
+}
+
+// ─── Helpers ─────────────────────────────────────────────────
+static DateTime readRtc() {
+    i2c_bus_lock();
+    DateTime t = _rtc->now();
+    i2c_bus_unlock();
+    return t;
+}
+
+static void onTimeSync(struct timeval* tv) {
+    _syncPending = true;   // runs in the LwIP task — real work happens in ntp_sync_tick()
+}
+
+static int64_t sysNow_us() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static uint32_t intervalForDrift(float ppm) {
+    if (isnan(ppm) || fabsf(ppm) < 0.01f) return isnan(ppm) ? NTP_RESYNC_MIN_S : NTP_RESYNC_MAX_S;
+    // error_ms = ppm * 1e-6 * interval_s * 1000
+    uint32_t s = (uint32_t)(NTP_MAX_ERROR_MS * 1000.0f / fabsf(ppm));
+    return constrain(s, NTP_RESYNC_MIN_S, NTP_RESYNC_MAX_S);
+}
+
+// The RTC second rtcSecond began at system time sys_us: compare and update
+// the drift estimate and aging offset. The RTC is only rewritten when the
+// drift window has elapsed or the error budget is blown, so the offset keeps
+// accumulating between syncs and the ppm estimate has something to measure.
+// The edge is known to within NTP_EDGE_MAX_LATENCY_MS, so loop latency never
+// reaches the aging register, and each step is capped in case it still does.
+// Returns true if the RTC should be rewritten.
+static bool measureOffset(uint32_t rtcSecond, int64_t sys_us) {
+    int64_t rtc_ms = (int64_t)rtcSecond * 1000;
+    int64_t sys_ms = sys_us / 1000;
+    int32_t offset = (int32_t)(rtc_ms - sys_ms);
+    _stats.lastOffset_ms = offset;
+
+    time_t now     = (time_t)(sys_ms / 1000);
+    bool   rewrite = _lastAdjust == 0 || abs(offset) > NTP_MAX_ERROR_MS;
+    if (_lastAdjust != 0 && now - _lastAdjust >= (time_t)NTP_DRIFT_WINDOW_S) {
+        rewrite = true;
+        float ppm = (float)offset * 1000.0f / (float)(now - _lastAdjust);
+        if (fabsf(ppm) <= NTP_DRIFT_MAX_PPM) {
+            _stats.drift_ppm = ppm;
+            // Positive aging slows the oscillator, so a fast RTC (offset > 0) needs more
+            int step  = constrain((int)lroundf(ppm / DS3231_AGING_PPM_LSB), -NTP_AGING_STEP_MAX, NTP_AGING_STEP_MAX);
+            int aging = constrain(_stats.aging + step, -128, 127);
+            if (aging != _stats.aging) {
+                writeAging((int8_t)aging);
+                _stats.aging = (int8_t)aging;
+            }
+        } else {
+            Serial.printf("✗ NTP drift %.1f ppm rejected\n", ppm);
+        }
+    }
+
+    _stats.interval_s = intervalForDrift(_stats.drift_ppm);
+    sntp_set_sync_interval(_stats.interval_s * 1000UL);
+
+    Serial.printf("✓ NTP sync #%lu | RTC offset %ld ms | drift %.2f ppm | aging %d | next %lus\n",
+                  (unsigned long)_stats.syncs, (long)offset, _stats.drift_ppm, _stats.aging,
+                  (unsigned long)_stats.interval_s);
+    return rewrite;
+}
+
+static void startEdgeSearch() {
+    _edgeSecond  = readRtc().second();
+    _edgeStart   = millis();
+    _edgeTick    = sqw_ticks();
+    _lastPoll_us = esp_timer_get_time();
+    _state       = SYNC_FIND_RTC_EDGE;
+}
+
+static void edgeMeasured(uint32_t rtcSecond, int64_t sys_us) {
+    if (!measureOffset(rtcSecond, sys_us)) { _state = SYNC_IDLE; return; }
+    _state = SYNC_WAIT_SYS_EDGE;
+}
+
+static void edgeFailed(const char* why) {
+    Serial.printf("✗ %s — skipping drift measurement\n", why);
+    _state = SYNC_WAIT_SYS_EDGE;
+}
+
+// With SQW the rollover is the falling edge, timestamped in its ISR; the RTC
+// only has to be read before the second is over and nothing waits on it.
+// Without SQW the edge is located by polling once per loop, then caught with
+// a short busy-poll a second later (catchEdge()).
+static void findEdge() {
+    int64_t now = esp_timer_get_time();
+    if (sqw_active()) {
+        if (sqw_ticks() == _edgeTick) {
+            if (millis() - _edgeStart >= NTP_EDGE_TIMEOUT_MS) edgeFailed("no SQW edge");
+            return;
+        }
+        int64_t edge    = sqw_last_edge_us();
+        int64_t sys     = sysNow_us() - (esp_timer_get_time() - edge);
+        DateTime rtcNow = readRtc();
+        if (esp_timer_get_time() - edge < 900000) {
+            edgeMeasured(rtcNow.unixtime(), sys);
+        } else if (++_edgeTries >= NTP_EDGE_TRIES) {
+            edgeFailed("SQW edges read too late");
+        } else {
+            _edgeTick  = sqw_ticks();    // read straddled the next second, try again
+            _edgeStart = millis();
+        }
+        return;
+    }
+
+    uint8_t sec = readRtc().second();
+    if (sec == _edgeSecond) {
+        _lastPoll_us = now;
+        if (millis() - _edgeStart >= NTP_EDGE_TIMEOUT_MS) edgeFailed("RTC seconds did not advance");
+        return;
+    }
+    _edgeSecond = sec;
+    if (now - _lastPoll_us > 2 * NTP_EDGE_GUARD_MS * 1000) {
+        // The loop was blocked across the rollover, so its phase is too
+        // vague for a short busy-poll; look again next second.
+        _lastPoll_us = now;
+        _edgeStart   = millis();
+        if (++_edgeTries >= NTP_EDGE_TRIES) edgeFailed("loop too slow to locate the RTC edge");
+        return;
+    }
+    // The rollover fell between _lastPoll_us and now; the next one is 1 s later.
+    _catchFrom_us = _lastPoll_us + 1000000 - NTP_EDGE_GUARD_MS * 1000;
+    _catchTo_us   = now + 1000000 + NTP_EDGE_GUARD_MS * 1000;
+    _state        = SYNC_CATCH_RTC_EDGE;
+}
+
+// The no-SQW fallback: spins from NTP_EDGE_GUARD_MS before the expected
+// rollover until the RTC shows it, so loop() stalls for up to
+// 2 × NTP_EDGE_GUARD_MS once per sync. With SQW this state is never entered.
+static void catchEdge() {
+    if (esp_timer_get_time() < _catchFrom_us) return;
+    int64_t  prev = 0;                  // start of the last read that still saw the old second
+    int64_t  start;
+    DateTime t;
+    for (;;) {
+        start = esp_timer_get_time();
+        t     = readRtc();
+        if (t.second() != _edgeSecond || start >= _catchTo_us) break;
+        prev = start;
+    }
+    int64_t after = esp_timer_get_time();
+    int64_t sys   = sysNow_us();
+    if (prev && t.second() != _edgeSecond && after - prev <= NTP_EDGE_MAX_LATENCY_MS * 1000) {
+        edgeMeasured(t.unixtime(), sys - (after - prev) / 2);   // midpoint of the last two reads
+        return;
+    }
+    if (++_edgeTries >= NTP_EDGE_TRIES) {
+        edgeFailed("RTC edge not caught within the latency limit");
+        return;
+    }
+    // Try the next second, from a fresh phase estimate.
+    _edgeSecond  = t.second();
+    _edgeStart   = millis();
+    _lastPoll_us = esp_timer_get_time();
+    _state       = SYNC_FIND_RTC_EDGE;
+}
+
+// Writing the seconds register restarts the DS3231 countdown chain, so the
+// write has to land right on a system-second edge. A write that would come
+// later than NTP_EDGE_MAX_LATENCY_MS after it is left for the next edge.
+static bool writeIfOnEdge() {
+    i2c_bus_lock();
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    bool onEdge = tv.tv_usec <= NTP_EDGE_MAX_LATENCY_MS * 1000L;
+    if (onEdge) {
+        _rtc->adjust(DateTime((uint32_t)tv.tv_sec));   // RTC holds UTC
+        _written = tv.tv_sec;
+    }
+    i2c_bus_unlock();
+    return onEdge;
+}
+
+// Runs on the esp_timer task at the system-second edge.
+static void onWriteTimer(void* arg) {
+    if (!writeIfOnEdge()) _writeLate = true;    // bus was busy, or the timer ran late
+    if (_pmLock) esp_pm_lock_release(_pmLock);
+}
+
+static void armWrite() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    _written   = 0;
+    _writeLate = false;
+    if (_pmLock) esp_pm_lock_acquire(_pmLock);   // waking from light sleep would make the write late
+    esp_timer_start_once(_writeTimer, 1000000 - tv.tv_usec + WRITE_SLACK_US);
+    _state = SYNC_WRITING;
+}
+
+static bool rtcWritten() {
+    _lastAdjust = _written;
+    _state      = SYNC_IDLE;
+    Serial.println("✓ DS3231 synced with NTP");
+    return true;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void ntp_sync_begin(RTC_DS3231* rtc, bool rtcOk, const char* server) {
+    _rtc       = rtc;
+    _rtcOk     = rtcOk;
+    _server    = server;
+    if (_rtcOk) _stats.aging = readAging();
+    sntp_set_time_sync_notification_cb(onTimeSync);
+
+    esp_timer_create_args_t args = {};
+    args.callback = onWriteTimer;
+    args.name     = "rtc_write";
+    if (_rtcOk && esp_timer_create(&args, &_writeTimer) != ESP_OK) {
+        _writeTimer = NULL;
+        Serial.println("✗ RTC write timer unavailable, polling for the second edge");
+    }
+    if (_writeTimer && esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "rtc_write", &_pmLock) != ESP_OK) _pmLock = NULL;
+}
+
+void ntp_sync_start() {
+    sntp_set_sync_interval(_stats.interval_s * 1000UL);
+    configTime(0, 0, _server);   // system clock stays in UTC, see tz.h
+}
+
+bool ntp_sync_tick() {
+    if (_syncPending && _state != SYNC_WRITING) {      // an armed write finishes first
+        _syncPending = false;
+        _valid       = true;
+        _stats.syncs++;
+        if (!_rtcOk) {
+            Serial.printf("✓ NTP sync #%lu (no RTC)\n", (unsigned long)_stats.syncs);
+            return true;
+        }
+        _edgeTries = 0;
+        startEdgeSearch();
+    }
+
+    switch (_state) {
+    case SYNC_IDLE:
+        return false;
+
+    case SYNC_FIND_RTC_EDGE:
+        findEdge();
+        return false;
+
+    case SYNC_CATCH_RTC_EDGE:
+        catchEdge();
+        return false;
+
+    case SYNC_WAIT_SYS_EDGE:
+        if (_writeTimer) {
+            armWrite();
+            return false;
+        }
+        // No timer: the loop lands inside the window after a few seconds
+        return writeIfOnEdge() && rtcWritten();
+
+    case SYNC_WRITING:
+        if (_writeLate) {
+            _state = SYNC_WAIT_SYS_EDGE;    // re-arm for the next second
+            return false;
+        }
+        return _written && rtcWritten();
+    }
+    return false;
+}
+
+bool ntp_sync_valid() { return _valid; }
+
+const NtpSyncStats& ntp_sync_stats() { return _stats; }
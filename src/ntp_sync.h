@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+#include <RTClib.h>
+
+// ─── Settings ───────────────────────────────────────────────
+#define NTP_MAX_ERROR_MS       250                  // RTC error budget between syncs
+#define NTP_RESYNC_MIN_S       3600UL               // 1 h
+#define NTP_RESYNC_MAX_S       86400UL              // 24 h
+#define NTP_DRIFT_WINDOW_S     21600UL              // need 6 h between syncs before trusting a ppm estimate
+#define NTP_DRIFT_MAX_PPM      5.0f                 // DS3231 is ±2 ppm; more is a bad measurement
+#define NTP_AGING_STEP_MAX     3                    // aging LSB moved per measurement at most
+#define NTP_EDGE_TIMEOUT_MS    1500                 // RTC seconds must roll over within this
+#define NTP_EDGE_MAX_LATENCY_MS 10                  // edge timing uncertainty above this = discard
+#define NTP_EDGE_GUARD_MS      30                   // no SQW: busy-poll starts this long before an expected edge
+#define NTP_EDGE_TRIES         5                    // seconds to try before giving up on a measurement
+#define DS3231_AGING_PPM_LSB   0.1f                 // approx. ppm per aging LSB at 25 °C
+
+struct NtpSyncStats {
+    uint32_t syncs;
+    int32_t  lastOffset_ms;     // RTC − NTP at the last sync (positive = RTC ahead)
+    float    drift_ppm;         // NAN until a full drift window has elapsed
+    int8_t   aging;             // DS3231 aging-offset register
+    uint32_t interval_s;        // current SNTP resync interval
+};
+
+// ─── Public API ─────────────────────────────────────────────
+void ntp_sync_begin(RTC_DS3231* rtc, bool rtcOk, const char* server);
+void ntp_sync_start();                      // call when WiFi comes up; returns immediately
+bool ntp_sync_tick();                       // call every loop(); true once the clock was corrected
+bool ntp_sync_valid();                      // system time has been set by SNTP at least once
+const NtpSyncStats& ntp_sync_stats();
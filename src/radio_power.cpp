@@ -0,0 +1,100 @@
+#include "radio_power.h"
+#include "wifi_manager.h"
+#include <WiFi.h>
+
+enum RadioUse {
+    USE_OFF    = 0,
+    USE_SLEEP  = 1,     // associated, idle
+    USE_ACTIVE = 2,     // associating, backing off, or a job in flight
+    USE_COUNT  = 3
+};
+
+static RadioPolicy   _policy      = RADIO_POLICY_ALWAYS_ON;
+static bool          _jobActive   = false;
+static unsigned long _offAt       = 0;      // 0 = no radio-off pending
+static unsigned long _wakeStart   = 0;      // 0 = not waiting for a link
+static unsigned long _lastTick    = 0;
+static uint64_t      _useMs[USE_COUNT] = {};
+
+static uint32_t _reconnects      = 0;
+static uint32_t _latencyLast_ms  = 0;
+static uint32_t _latencyMax_ms   = 0;
+static uint64_t _latencySum_ms   = 0;
+
+// ─── Helpers ─────────────────────────────────────────────────
+static RadioUse currentUse() {
+    switch (wifi_mgr_state()) {
+    case WIFI_MGR_OFF:       return USE_OFF;
+    case WIFI_MGR_CONNECTED: return _jobActive ? USE_ACTIVE : USE_SLEEP;
+    default:                 return USE_ACTIVE;
+    }
+}
+
+static float sleepCurrent() {
+    return _policy == RADIO_POLICY_MODEM_SLEEP ? RADIO_MA_MAX_MODEM : RADIO_MA_MIN_MODEM;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void radio_power_begin(RadioPolicy policy) {
+    _policy    = policy;
+    _lastTick  = millis();
+    _wakeStart = _lastTick;
+    if (_policy == RADIO_POLICY_MODEM_SLEEP) wifi_mgr_set_listen_interval(RADIO_LISTEN_INTERVAL);
+}
+
+void radio_power_tick(unsigned long nextJobDue_ms) {
+    unsigned long ms = millis();
+    _useMs[currentUse()] += ms - _lastTick;
+    _lastTick = ms;
+
+    if (_policy != RADIO_POLICY_DUTY_CYCLE) return;
+
+    if (_offAt && (long)(ms - _offAt) >= 0) {
+        _offAt = 0;
+        wifi_mgr_stop();
+        Serial.println("✓ Radio off until next job");
+    }
+    if (wifi_mgr_state() == WIFI_MGR_OFF && (long)(nextJobDue_ms - ms) <= RADIO_WAKE_LEAD_MS) {
+        _wakeStart = ms;
+        wifi_mgr_start();
+    }
+}
+
+void radio_power_job_started() {
+    _jobActive = true;
+    _offAt     = 0;
+}
+
+void radio_power_job_done() {
+    _jobActive = false;
+    if (_policy == RADIO_POLICY_DUTY_CYCLE) _offAt = millis() + RADIO_JOB_GRACE_MS;
+}
+
+void radio_power_link_up() {
+    if (_policy == RADIO_POLICY_MODEM_SLEEP) WiFi.setSleep(WIFI_PS_MAX_MODEM);
+    if (_wakeStart) {
+        _latencyLast_ms = millis() - _wakeStart;
+        _latencyMax_ms  = max(_latencyMax_ms, _latencyLast_ms);
+        _latencySum_ms += _latencyLast_ms;
+        _reconnects++;
+        _wakeStart = 0;
+    }
+}
+
+void radio_power_report() {
+    uint64_t total = _useMs[USE_OFF] + _useMs[USE_SLEEP] + _useMs[USE_ACTIVE];
+    if (total == 0) return;
+    float mA = (_useMs[USE_OFF]    * RADIO_MA_OFF +
+                _useMs[USE_SLEEP]  * sleepCurrent() +
+                _useMs[USE_ACTIVE] * RADIO_MA_ACTIVE) / (float)total;
+    Serial.printf("Radio: policy %d | off %.1f%% sleep %.1f%% active %.1f%% | est. %.1f mA | "
+                  "connect latency last %lu avg %lu max %lu ms (%lu)\n",
+                  _policy,
+                  100.0f * _useMs[USE_OFF]    / total,
+                  100.0f * _useMs[USE_SLEEP]  / total,
+                  100.0f * _useMs[USE_ACTIVE] / total,
+                  mA,
+                  (unsigned long)_latencyLast_ms,
+                  (unsigned long)(_reconnects ? _latencySum_ms / _reconnects : 0),
+                  (unsigned long)_latencyMax_ms, (unsigned long)_reconnects);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+
+// ─── Radio power policy ─────────────────────────────────────
+// The only traffic is a weather fetch every few minutes and the occasional
+// NTP exchange, so the radio can sleep (or be off) almost all the time.
+enum RadioPolicy {
+    RADIO_POLICY_ALWAYS_ON   = 0,   // driver default (WIFI_PS_MIN_MODEM, DTIM listen)
+    RADIO_POLICY_MODEM_SLEEP = 1,   // WIFI_PS_MAX_MODEM with a long listen interval
+    RADIO_POLICY_DUTY_CYCLE  = 2    // radio off between jobs, reconnect just before the next one
+};
+
+#define RADIO_LISTEN_INTERVAL   10          // beacons (~1 s at 102.4 ms) in modem-sleep mode
+#define RADIO_WAKE_LEAD_MS      8000        // start reconnecting this early before a job is due
+#define RADIO_JOB_GRACE_MS      10000       // keep the link this long for async work (SNTP)
+
+// Rough radio-attributable current per state, used for the estimate in the
+// report. Tune against a meter for a real board.
+#define RADIO_MA_ACTIVE         80.0f       // associating / transferring
+#define RADIO_MA_MIN_MODEM      20.0f
+#define RADIO_MA_MAX_MODEM      6.0f
+#define RADIO_MA_OFF            0.0f
+
+// ─── Public API ─────────────────────────────────────────────
+void radio_power_begin(RadioPolicy policy);      // before wifi_mgr_begin()
+void radio_power_tick(unsigned long nextJobDue_ms);
+void radio_power_job_started();                  // a network job is about to use the link
+void radio_power_job_done();                     // all jobs for this wake-up are finished
+void radio_power_link_up();                      // call on every wifi_mgr_take_link_up()
+void radio_power_report();
@@ -0,0 +1,158 @@
+#include "rtc_sqw.h"
+#include "i2c_bus.h"
+#include <esp_pm.h>
+#include <esp_timer.h>
+
+static volatile uint32_t _epoch      = 0;      // UTC second that started at the last edge
+static volatile uint32_t _ticks      = 0;      // seconds counted by the ISR
+static volatile uint32_t _edges      = 0;
+static volatile int64_t  _lastEdge_us = 0;
+static volatile bool     _awake      = false;  // PM lock held for the coming edge
+
+static esp_pm_lock_handle_t _pmLock       = NULL;
+static esp_timer_handle_t   _wakeTimer    = NULL;
+static uint32_t             _windows      = 0;     // wake windows opened
+static uint32_t             _emptyWindows = 0;     // windows the next wake found still open
+
+static uint32_t      _seenTicks   = 0;         // _ticks at the last sqw_take_tick()
+static bool          _synced      = false;
+static unsigned long _lastResync  = 0;
+static uint32_t      _resyncs     = 0;
+static int32_t       _lastCorrection = 0;      // s, RTC − soft clock at the last resync
+static uint32_t      _corrections = 0;         // resyncs that changed the soft clock
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void IRAM_ATTR onEdge() {
+    int64_t now = esp_timer_get_time();
+    uint32_t n  = 1;
+    if (_lastEdge_us) {
+        int64_t gap = now - _lastEdge_us;
+        if (gap < 500000) return;                           // glitch, not a new second
+        n = (uint32_t)((gap + 500000) / 1000000);           // > 1 if an edge was missed
+    }
+    _lastEdge_us = now;
+    _epoch += n;
+    _ticks += n;
+    _edges++;
+    if (_awake) {
+        _awake = false;
+        esp_pm_lock_release(_pmLock);
+    }
+}
+
+// esp_timer task, SQW_WAKE_LEAD_MS before the next edge is due. Re-armed from
+// the latest edge every time, so the window follows the RTC rather than the
+// ESP32's own clock.
+static void onWake(void*) {
+    int64_t now  = esp_timer_get_time();
+    int64_t last = sqw_last_edge_us();
+    int64_t lead = (int64_t)SQW_WAKE_LEAD_MS * 1000;
+
+    noInterrupts();
+    bool open = _awake;
+    bool live = last && now - last < (int64_t)SQW_TIMEOUT_MS * 1000;
+    if (live && !open) {
+        _awake = true;
+        esp_pm_lock_acquire(_pmLock);
+    } else if (!live && open) {
+        _awake = false;                             // no square wave: don't keep the chip up for it
+        esp_pm_lock_release(_pmLock);
+    }
+    interrupts();
+
+    if (open) _emptyWindows++;
+    if (live) _windows++;
+
+    int64_t next = now + 1000000;
+    if (live) {
+        int64_t k = (now - last + lead) / 1000000 + 1;  // seconds from the last edge to the one after next
+        next      = last + k * 1000000 - lead;
+    }
+    esp_timer_start_once(_wakeTimer, max<int64_t>(next - now, 1000));
+}
+
+static void startWakeTimer() {
+    if (esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "sqw", &_pmLock) != ESP_OK) return;
+    esp_timer_create_args_t args = {};
+    args.callback = onWake;
+    args.name     = "sqw_wake";
+    if (esp_timer_create(&args, &_wakeTimer) != ESP_OK) {
+        esp_pm_lock_delete(_pmLock);
+        _pmLock = NULL;
+        return;
+    }
+    esp_timer_start_once(_wakeTimer, 1000000);
+}
+
+// ─── Public ─────────────────────────────────────────────────
+bool sqw_begin(RTC_DS3231* rtc, uint8_t pin) {
+    i2c_bus_lock();
+    rtc->writeSqwPinMode(DS3231_SquareWave1Hz);
+    bool ok = rtc->readSqwPinMode() == DS3231_SquareWave1Hz;
+    i2c_bus_unlock();
+    if (!ok) {
+        Serial.println("✗ DS3231 SQW not enabled");
+        return false;
+    }
+    pinMode(pin, INPUT_PULLUP);        // SQW is open drain
+    attachInterrupt(digitalPinToInterrupt(pin), onEdge, FALLING);
+    startWakeTimer();
+    Serial.printf("✓ DS3231 1 Hz SQW on GPIO%d%s\n", pin, _wakeTimer ? ", awake for each edge" : "");
+    return true;
+}
+
+bool sqw_active() {
+    noInterrupts();
+    int64_t last = _lastEdge_us;       // 64-bit, not atomic on this core
+    interrupts();
+    if (!_synced || !last) return false;
+    return esp_timer_get_time() - last < (int64_t)SQW_TIMEOUT_MS * 1000;
+}
+
+bool sqw_take_tick() {
+    uint32_t t = _ticks;
+    if (t == _seenTicks) return false;
+    _seenTicks = t;
+    return true;
+}
+
+time_t sqw_now() { return _synced ? (time_t)_epoch : 0; }
+
+uint32_t sqw_ticks() { return _ticks; }
+
+int64_t sqw_last_edge_us() {
+    noInterrupts();
+    int64_t last = _lastEdge_us;
+    interrupts();
+    return last;
+}
+
+void sqw_resync(uint32_t unixtime, uint32_t ticksAtRequest) {
+    noInterrupts();
+    uint32_t target = unixtime + (_ticks - ticksAtRequest);    // edges that landed while the read was in flight
+    int32_t  diff   = (int32_t)(target - _epoch);
+    _epoch = target;
+    interrupts();
+
+    if (_synced && diff != 0) {
+        _corrections++;
+        Serial.printf("✗ SQW clock off by %lds, corrected\n", (long)diff);
+    }
+    _lastCorrection = _synced ? diff : 0;
+    _synced     = true;
+    _lastResync = millis();
+    _resyncs++;
+}
+
+bool sqw_resync_due() { return !_synced || millis() - _lastResync >= SQW_RESYNC_MS; }
+
+void sqw_report() {
+    uint32_t ticks = _ticks, edges = _edges;
+    Serial.printf("SQW: %s | %lu edges %lu s, %lu missed (%.2f%%) | wake windows %lu, %lu without edge | "
+                  "resyncs %lu (%lu corrected, last %lds)\n",
+                  sqw_active() ? "active" : "inactive",
+                  (unsigned long)edges, (unsigned long)ticks, (unsigned long)(ticks - edges),
+                  ticks ? 100.0f * (ticks - edges) / ticks : 0.0f,
+                  (unsigned long)_windows, (unsigned long)_emptyWindows,
+                  (unsigned long)_resyncs, (unsigned long)_corrections, (long)_lastCorrection);
+}
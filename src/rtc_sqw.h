@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+#include <RTClib.h>
+#include <time.h>
+
+// ─── DS3231 1 Hz square wave ────────────────────────────────
+// The RTC's SQW/INT pin is set to a 1 Hz square wave and its falling edge,
+// which coincides with the seconds register rolling over, drives a software
+// clock from a GPIO interrupt. Reading the time is then a volatile load, the
+// seconds blink can restart on the real edge, and the RTC only needs to be
+// read over I2C to resync.
+// A GPIO edge does not wake the C3 from light sleep, so an edge arriving
+// while it sleeps is lost. A timer armed from each edge takes a
+// no-light-sleep PM lock SQW_WAKE_LEAD_MS before the next one is due and the
+// ISR releases it. The ISR counts elapsed seconds rather than edges, so an
+// edge that is missed anyway still advances the clock; sqw_report() counts
+// those and the wake windows that closed without an edge.
+#define SQW_PIN             5
+#define SQW_TIMEOUT_MS      2500        // no edge for this long = fall back to polling
+#define SQW_WAKE_LEAD_MS    10          // stay awake from this long before each expected edge
+#define SQW_RESYNC_MS       3600000UL   // re-read the RTC hourly
+
+// ─── Public API ─────────────────────────────────────────────
+bool     sqw_begin(RTC_DS3231* rtc, uint8_t pin);     // enables the output, attaches the interrupt
+bool     sqw_active();                                // edges seen recently and the clock has been set
+bool     sqw_take_tick();                             // true once per second, in loop()
+time_t   sqw_now();                                   // UTC, 0 until the first resync
+uint32_t sqw_ticks();                                 // seconds counted since begin
+int64_t  sqw_last_edge_us();                          // esp_timer time of the latest edge, 0 = none yet
+void     sqw_resync(uint32_t unixtime, uint32_t ticksAtRequest);   // RTC value read after ticksAtRequest
+bool     sqw_resync_due();
+void     sqw_report();
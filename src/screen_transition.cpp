@@ -0,0 +1,129 @@
+#include "screen_transition.h"
+#include <esp_timer.h>
+
+#define PANEL_LINES  320      // ST7789 rows along the scroll axis
+
+struct TransitionStats {
+    uint32_t count;
+    uint32_t frames;
+    uint64_t frame_us;
+    uint32_t frameMax_us;
+    uint32_t durationMax_ms;
+};
+
+static lgfx::LGFX_Device* _tft        = NULL;
+static lv_display_t*      _disp       = NULL;
+static TransitionType     _pending    = TRANSITION_NONE;
+static uint8_t            _brightness = 255;
+static TransitionStats    _stats      = {};
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void panelCommand16(uint8_t cmd, const uint16_t* data, int n) {
+    _tft->startWrite();
+    _tft->writeCommand(cmd);
+    for (int i = 0; i < n; i++) _tft->writeData16(data[i]);
+    _tft->endWrite();
+}
+
+static void setScrollStart(uint16_t line) {
+    uint16_t v = line % PANEL_LINES;
+    panelCommand16(0x37, &v, 1);          // VSCSAD
+}
+
+// Renders one column range of the active screen right now
+static uint32_t renderColumns(int32_t x1, int32_t x2) {
+    int64_t start = esp_timer_get_time();
+    lv_area_t a = { x1, 0, x2, lv_display_get_vertical_resolution(_disp) - 1 };
+    lv_display_enable_invalidation(_disp, true);
+    lv_obj_invalidate_area(lv_screen_active(), &a);
+    lv_display_enable_invalidation(_disp, false);
+    lv_refr_now(_disp);
+    return (uint32_t)(esp_timer_get_time() - start);
+}
+
+static void countFrame(uint32_t us) {
+    _stats.frames++;
+    _stats.frame_us   += us;
+    _stats.frameMax_us = max(_stats.frameMax_us, us);
+}
+
+// At scroll start S the panel shows GRAM lines S..319 then 0..S-1, so the
+// old screen slides off one edge and lines 0..S-1 appear at the other.
+// Those lines are exactly where the incoming screen's leading columns
+// belong, so each step renders them into place and the final wrap to
+// S = 0 leaves the new screen unscrolled.
+static void playPush() {
+    int32_t width = lv_display_get_horizontal_resolution(_disp);
+    for (int32_t s = TRANSITION_STEP_PX; s <= width; s += TRANSITION_STEP_PX) {
+        unsigned long stepStart = millis();
+        setScrollStart(s);
+        uint32_t us = TRANSITION_SCROLL_REVERSED
+                    ? renderColumns(width - s, width - s + TRANSITION_STEP_PX - 1)
+                    : renderColumns(s - TRANSITION_STEP_PX, s - 1);
+        countFrame(us);
+        while (millis() - stepStart < TRANSITION_STEP_MS) delay(1);
+    }
+}
+
+static void fadeBacklight(uint8_t from, uint8_t to) {
+    unsigned long start = millis();
+    for (;;) {
+        unsigned long t = millis() - start;
+        if (t >= TRANSITION_FADE_MS) break;
+        _tft->setBrightness(from + ((int)to - from) * (int)t / TRANSITION_FADE_MS);
+        delay(8);
+    }
+    _tft->setBrightness(to);
+}
+
+static void playFade() {
+    fadeBacklight(_brightness, 0);
+    countFrame(renderColumns(0, lv_display_get_horizontal_resolution(_disp) - 1));
+    fadeBacklight(0, _brightness);
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void screen_transition_begin(lgfx::LGFX_Device* tft, lv_display_t* disp) {
+    _tft  = tft;
+    _disp = disp;
+    const uint16_t area[3] = { 0, PANEL_LINES, 0 };     // VSCRDEF: whole panel scrolls
+    panelCommand16(0x33, area, 3);
+    setScrollStart(0);
+}
+
+void screen_transition_load(lv_obj_t* screen, TransitionType type) {
+    if (type != TRANSITION_NONE && _tft) {
+        lv_refr_now(_disp);                             // flush whatever the old screen still owes
+        lv_display_enable_invalidation(_disp, false);
+        _pending = type;
+    }
+    lv_scr_load(screen);
+}
+
+void screen_transition_play() {
+    if (_pending == TRANSITION_NONE) return;
+    TransitionType type = _pending;
+    _pending = TRANSITION_NONE;
+
+    unsigned long start = millis();
+    if (type == TRANSITION_PUSH) playPush();
+    else                         playFade();
+    lv_display_enable_invalidation(_disp, true);
+
+    uint32_t ms = millis() - start;
+    _stats.count++;
+    _stats.durationMax_ms = max(_stats.durationMax_ms, ms);
+}
+
+void screen_transition_set_brightness(uint8_t level) {
+    _brightness = level;
+    if (_pending != TRANSITION_FADE) _tft->setBrightness(level);
+}
+
+void screen_transition_report() {
+    if (!_stats.count) return;
+    Serial.printf("Transitions: %lu | %lu frames avg %lu us max %lu us | longest %lu ms\n",
+                  (unsigned long)_stats.count, (unsigned long)_stats.frames,
+                  (unsigned long)(_stats.frames ? _stats.frame_us / _stats.frames : 0),
+                  (unsigned long)_stats.frameMax_us, (unsigned long)_stats.durationMax_ms);
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <lvgl.h>
+
+// ─── Screen transitions ─────────────────────────────────────
+// Snapshotting both screens would take 2 × 150 KB, so transitions lean on
+// the panel instead:
+//  - PUSH uses the ST7789's vertical scroll, which runs along the 320 px
+//    axis and so scrolls sideways in landscape. Each step advances the scroll
+//    start by TRANSITION_STEP_PX and LVGL renders only the incoming screen's
+//    columns that just wrapped round to the edge. The outgoing screen is never
+//    redrawn, and each incoming pixel is drawn exactly once.
+//  - FADE dims the backlight, renders the new screen once and brings the
+//    backlight back up.
+// Screen invalidation is held off from load until play, so labels set in
+// between don't trigger a full redraw of their own.
+#define TRANSITION_STEP_PX        20          // columns revealed per push step (divides 320)
+#define TRANSITION_STEP_MS        12          // minimum time per push step
+#define TRANSITION_FADE_MS        160         // each way
+#define TRANSITION_SCROLL_REVERSED 0          // 1 if the panel scrolls the other way in this rotation
+
+enum TransitionType {
+    TRANSITION_NONE = 0,
+    TRANSITION_PUSH = 1,
+    TRANSITION_FADE = 2
+};
+
+// ─── Public API ─────────────────────────────────────────────
+void screen_transition_begin(lgfx::LGFX_Device* tft, lv_display_t* disp);
+void screen_transition_load(lv_obj_t* screen, TransitionType type);   // loads now, draws in play()
+void screen_transition_play();                                        // after the new screen is populated
+void screen_transition_set_brightness(uint8_t level);                 // backlight target, held during fades
+void screen_transition_report();
@@ -0,0 +1,148 @@
+#include "solar.h"
+#include "tz.h"
+
+// Binary angle: 2^32 = 360°. Constants fold to integers at compile time.
+#define BAM(deg)        ((uint32_t)(int64_t)((deg) * (4294967296.0 / 360.0)))
+#define Q15_ONE         32767
+#define Q15_SCALE       32768LL                     // 1 << 15 as a factor: signed values may be negative
+
+#define J2000_EPOCH     946728000LL                 // 2000-01-01 12:00 UTC
+#define M_AT_J2000      BAM(357.5291)               // mean anomaly
+#define M_PER_DAY       11758745LL                  // 0.98560028°/day in BAM
+#define C1              ((int64_t)BAM(1.9148))      // equation of centre
+#define C2              ((int64_t)BAM(0.0200))
+#define C3              ((int64_t)BAM(0.0003))
+#define PERIHELION      BAM(180.0 + 102.9372)
+#define SIN_OBLIQUITY   13034                       // sin(23.44°), Q15
+#define SIN_HORIZON     -476                        // sin(-0.833°), refraction + solar disc, Q15
+
+static const int16_t sinTable[65] = {
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767,
+};
+
+static int32_t  _sinLat     = 0;
+static int32_t  _cosLat     = Q15_ONE;
+static int32_t  _lonSeconds = 0;             // 4 min of clock time per degree
+static SolarDay _today      = {};
+static int32_t  _dayKey     = INT32_MIN;
+
+// ─── Helpers ─────────────────────────────────────────────────
+static int32_t isin(uint32_t a) {
+    uint32_t quadrant = a >> 30;
+    uint32_t x        = a & 0x3FFFFFFF;
+    if (quadrant & 1) x = 0x40000000 - x;
+    uint32_t i = x >> 24;
+    int32_t  v = sinTable[i];
+    if (i < 64) v += (int32_t)(((int64_t)(sinTable[i + 1] - sinTable[i]) * (x & 0xFFFFFF)) >> 24);
+    return (quadrant & 2) ? -v : v;
+}
+
+static int32_t icos(uint32_t a) { return isin(a + 0x40000000); }
+
+// Binary search on the monotonic half-turn; c in Q15, result in [0, 180°].
+static uint32_t iacos(int32_t c) {
+    uint32_t lo = 0, hi = 0x80000000;
+    for (int i = 0; i < 24; i++) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (icos(mid) > c) lo = mid;
+        else               hi = mid;
+    }
+    return lo + (hi - lo) / 2;
+}
+
+static int32_t isqrt(int64_t v) {
+    if (v <= 0) return 0;
+    int64_t r = 0, bit = 1LL << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+        else              { r >>= 1; }
+        bit >>= 2;
+    }
+    return (int32_t)r;
+}
+
+static int32_t localDayOf(time_t utc) {
+    int64_t local = (int64_t)utc + tz_offset_sec(utc);
+    return (int32_t)(local >= 0 ? local / 86400 : (local - 86399) / 86400);
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void solar_set_location(double lat, double lon) {
+    uint32_t a  = BAM(lat);
+    _sinLat     = isin(a);
+    _cosLat     = icos(a);
+    _lonSeconds = (int32_t)lround(lon * 240.0);
+    _dayKey     = INT32_MIN;     // recompute on the next update
+}
+
+SolarDay solar_compute(int32_t localDay) {
+    SolarDay d = {};
+    int64_t noon = (int64_t)localDay * 86400 + 43200 - _lonSeconds;   // mean solar noon, UTC
+
+    uint32_t M   = M_AT_J2000 + (uint32_t)(((noon - J2000_EPOCH) * M_PER_DAY) / 86400);
+    int32_t  sM  = isin(M);
+    int64_t  C   = (C1 * sM + C2 * isin(2 * M) + C3 * isin(3 * M)) >> 15;
+    uint32_t L   = M + (uint32_t)C + PERIHELION;        // ecliptic longitude
+
+    // Equation of time: 0.0053 d·sin M - 0.0069 d·sin 2L
+    d.noon = (time_t)(noon + (458LL * sM - 596LL * isin(2 * L)) / Q15_ONE);
+
+    int32_t sinDec = (int32_t)(((int64_t)isin(L) * SIN_OBLIQUITY) >> 15);
+    int32_t cosDec = isqrt((int64_t)Q15_ONE * Q15_ONE - (int64_t)sinDec * sinDec);
+
+    int64_t num = SIN_HORIZON * Q15_SCALE - (int64_t)_sinLat * sinDec;
+    int64_t den = (int64_t)_cosLat * cosDec;
+    int64_t c   = den ? num * Q15_SCALE / den : (num > 0 ? Q15_ONE : -Q15_ONE);
+    if (c >= Q15_ONE) {
+        d.polar   = -1;
+        d.sunrise = d.sunset = d.noon;
+        return d;
+    }
+    if (c <= -Q15_ONE) {
+        d.polar   = 1;
+        d.sunrise = d.noon - 43200;
+        d.sunset  = d.noon + 43200;
+        return d;
+    }
+    time_t half = (time_t)(((uint64_t)iacos((int32_t)c) * 86400) >> 32);
+    d.sunrise = d.noon - half;
+    d.sunset  = d.noon + half;
+    return d;
+}
+
+bool solar_update(time_t utc) {
+    int32_t day = localDayOf(utc);
+    if (day == _dayKey) return false;
+    _dayKey = day;
+    _today  = solar_compute(day);
+    int rise = solar_local_minutes(_today.sunrise);
+    int set  = solar_local_minutes(_today.sunset);
+    Serial.printf("✓ Sun: rise %02d:%02d set %02d:%02d%s\n", rise / 60, rise % 60, set / 60, set % 60,
+                  _today.polar ? (_today.polar > 0 ? " (midnight sun)" : " (polar night)") : "");
+    return true;
+}
+
+bool solar_valid() { return _dayKey != INT32_MIN; }
+
+bool solar_is_day(time_t utc) {
+    if (_today.polar) return _today.polar > 0;
+    return utc >= _today.sunrise && utc < _today.sunset;
+}
+
+const SolarDay& solar_today() { return _today; }
+
+int solar_local_minutes(time_t utc) {
+    int64_t local = (int64_t)utc + tz_offset_sec(utc);
+    int64_t s     = local % 86400;
+    if (s < 0) s += 86400;
+    return (int)(s / 60);
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <Arduino.h>
+#include <time.h>
+
+// ─── Sunrise / sunset ───────────────────────────────────────
+// Sunrise equation (mean anomaly, equation of centre, declination, hour
+// angle at -0.833°) evaluated entirely in integer maths: angles are 32-bit
+// binary turns, sines come from a 65-entry quarter-wave table in Q15.
+// Good to about a minute between the polar circles. Recomputed once per
+// local day; everything else is a compare against the cached times.
+
+struct SolarDay {
+    time_t  sunrise;            // UTC
+    time_t  sunset;             // UTC
+    time_t  noon;               // UTC, solar transit
+    int8_t  polar;              // 0 normal, +1 sun never sets, -1 sun never rises
+};
+
+// ─── Public API ─────────────────────────────────────────────
+void            solar_set_location(double lat, double lon);   // degrees, north/east positive
+SolarDay        solar_compute(int32_t localDay);     // localDay = days since 1970-01-01 of the local date
+bool            solar_update(time_t utc);            // recompute if the local date changed, true if it did
+bool            solar_valid();
+bool            solar_is_day(time_t utc);            // sunrise <= utc < sunset of the current local day
+const SolarDay& solar_today();
+int             solar_local_minutes(time_t utc);     // minutes since local midnight
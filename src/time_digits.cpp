@@ -0,0 +1,240 @@
+#include "time_digits.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+struct DigitSlot {
+    lv_draw_buf_t buf;
+    int8_t        digit;      // -1 = empty
+    uint32_t      used;       // LRU stamp
+};
+
+struct DigitStats {
+    uint32_t hits;
+    uint32_t renders;
+    uint32_t render_us;
+    uint32_t renderMax_us;
+    uint32_t updates;         // frames that redrew a changed time
+    uint32_t update_us;
+    uint32_t updateMax_us;
+};
+
+static lv_obj_t*      _labels[2]   = { NULL, NULL };    // hour, minute
+static lv_obj_t*      _images[4]   = { NULL, NULL, NULL, NULL };
+static lv_obj_t*      _canvas      = NULL;
+static DigitSlot      _slots[TIME_DIGIT_SLOTS];
+static uint8_t*       _mem         = NULL;
+static size_t         _slotBytes   = 0;
+static lv_color_format_t _cf       = LV_COLOR_FORMAT_RGB565;   // the display's, so cells blit unconverted
+static const lv_font_t* _font      = NULL;
+static lv_color_t     _color;
+static lv_color_t     _bg;
+static int32_t        _letterSpace = 0;
+static int32_t        _cellTop     = 0;     // first glyph row inside the label box
+static int32_t        _cellH       = 0;
+static uint32_t       _lruClock    = 0;
+static int            _shown[4]    = { -1, -1, -1, -1 };
+static bool           _cached      = false;
+
+static bool           _pending     = false;  // time changed, next refresh is an update frame
+static int64_t        _refrStart   = 0;
+static DigitStats     _stats       = {};
+
+// ─── Helpers ─────────────────────────────────────────────────
+static uint32_t glyphLetter(int d) { return '0' + d; }
+
+static bool glyph(int d, lv_font_glyph_dsc_t& g, int next = -1) {
+    return lv_font_get_glyph_dsc(_font, &g, glyphLetter(d), next < 0 ? 0 : glyphLetter(next));
+}
+
+// Vertical extent of all ten digits, the same way lv_draw_label places them
+static void measureCells(int32_t boxH, int32_t& maxW) {
+    int32_t top = INT32_MAX, bottom = INT32_MIN;
+    maxW = 0;
+    for (int d = 0; d < 10; d++) {
+        lv_font_glyph_dsc_t g;
+        if (!glyph(d, g)) continue;
+        int32_t y = _font->line_height - _font->base_line - g.box_h - g.ofs_y;
+        top    = min(top, y);
+        bottom = max(bottom, y + (int32_t)g.box_h);
+        maxW   = max(maxW, (int32_t)g.box_w);
+    }
+    _cellTop = max<int32_t>(top, 0);
+    _cellH   = min(bottom, boxH) - _cellTop;
+}
+
+static void renderSlot(DigitSlot& s, int d) {
+    int64_t start = esp_timer_get_time();
+    lv_font_glyph_dsc_t g;
+    glyph(d, g);
+    int32_t w = max<int32_t>(g.box_w, 1);
+    lv_draw_buf_init(&s.buf, w, _cellH, _cf, lv_draw_buf_width_to_stride(w, _cf), s.buf.data, _slotBytes);
+    lv_canvas_set_draw_buf(_canvas, &s.buf);
+    lv_canvas_fill_bg(_canvas, _bg, LV_OPA_COVER);
+
+    char text[2] = { (char)glyphLetter(d), 0 };
+    lv_layer_t layer;
+    lv_canvas_init_layer(_canvas, &layer);
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font  = _font;
+    dsc.color = _color;
+    dsc.text  = text;
+    lv_area_t coords = { -g.ofs_x, -_cellTop, -g.ofs_x + (int32_t)g.adv_w - 1, -_cellTop + _font->line_height - 1 };
+    lv_draw_label(&layer, &dsc, &coords);
+    lv_canvas_finish_layer(_canvas, &layer);
+    lv_image_cache_drop(&s.buf);
+
+    s.digit = d;
+    uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+    _stats.renders++;
+    _stats.render_us += us;
+    _stats.renderMax_us = max(_stats.renderMax_us, us);
+}
+
+static DigitSlot* slotFor(int d, const int* wanted) {
+    DigitSlot* victim = NULL;
+    for (int i = 0; i < TIME_DIGIT_SLOTS; i++) {
+        DigitSlot& s = _slots[i];
+        if (s.digit == d) {
+            _stats.hits++;
+            s.used = ++_lruClock;
+            return &s;
+        }
+        bool pinned = false;
+        for (int k = 0; k < 4; k++) pinned |= s.digit >= 0 && s.digit == wanted[k];
+        if (!pinned && (!victim || s.used < victim->used)) victim = &s;
+    }
+    renderSlot(*victim, d);             // TIME_DIGIT_SLOTS ≥ 4 guarantees a victim
+    victim->used = ++_lruClock;
+    return victim;
+}
+
+// Pen positions follow lv_label: hours right-aligned, minutes left-aligned,
+// letter spacing and kerning between the two digits of a pair.
+static void placePair(int pair, int a, int b) {
+    lv_area_t box;
+    lv_obj_get_coords(_labels[pair], &box);
+    lv_obj_t* parent = lv_obj_get_parent(_labels[pair]);
+    lv_area_t pbox;
+    lv_obj_get_coords(parent, &pbox);
+
+    lv_font_glyph_dsc_t ga, gb;
+    glyph(a, ga, b);
+    glyph(b, gb);
+    int32_t width = ga.adv_w + _letterSpace + gb.adv_w;
+    int32_t pen   = pair == 0 ? box.x2 + 1 - width : box.x1;
+    int32_t y     = box.y1 + _cellTop - pbox.y1;
+
+    lv_obj_set_pos(_images[pair * 2],     pen + ga.ofs_x - pbox.x1, y);
+    lv_obj_set_pos(_images[pair * 2 + 1], pen + ga.adv_w + _letterSpace + gb.ofs_x - pbox.x1, y);
+}
+
+static void onDisplayEvent(lv_event_t* e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_REFR_START) {
+        _refrStart = _pending ? esp_timer_get_time() : 0;
+        _pending   = false;
+    } else if (code == LV_EVENT_REFR_READY && _refrStart) {
+        uint32_t us = (uint32_t)(esp_timer_get_time() - _refrStart);
+        _refrStart = 0;
+        _stats.updates++;
+        _stats.update_us += us;
+        _stats.updateMax_us = max(_stats.updateMax_us, us);
+    }
+}
+
+static bool allocateCells(lv_obj_t* hourLabel) {
+    int32_t maxW;
+    measureCells(lv_obj_get_height(hourLabel), maxW);
+    _slotBytes = lv_draw_buf_width_to_stride(maxW, _cf) * _cellH;
+    size_t total = _slotBytes * TIME_DIGIT_SLOTS;
+    if (_cellH <= 0 || heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) < total ||
+        heap_caps_get_free_size(MALLOC_CAP_8BIT) < total + TIME_DIGIT_MIN_HEAP) {
+        Serial.printf("✗ Digit cache needs %u B, using labels\n", (unsigned)total);
+        return false;
+    }
+    _mem = (uint8_t*)heap_caps_malloc(total, MALLOC_CAP_8BIT);
+    if (!_mem) return false;
+    for (int i = 0; i < TIME_DIGIT_SLOTS; i++) {
+        _slots[i].buf.data = _mem + i * _slotBytes;
+        _slots[i].digit    = -1;
+        _slots[i].used     = 0;
+    }
+    return true;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+bool time_digits_begin(lv_display_t* disp, lv_obj_t* hourLabel, lv_obj_t* minuteLabel) {
+    _labels[0] = hourLabel;
+    _labels[1] = minuteLabel;
+    lv_display_add_event_cb(disp, onDisplayEvent, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, onDisplayEvent, LV_EVENT_REFR_READY, NULL);
+    if (!TIME_DIGIT_CACHE || !hourLabel || !minuteLabel) return false;
+
+    lv_obj_t* screen = lv_obj_get_parent(hourLabel);
+    lv_obj_update_layout(screen);
+    _font        = lv_obj_get_style_text_font(hourLabel, LV_PART_MAIN);
+    _color       = lv_obj_get_style_text_color(hourLabel, LV_PART_MAIN);
+    _bg          = lv_obj_get_style_bg_color(screen, LV_PART_MAIN);
+    _letterSpace = lv_obj_get_style_text_letter_space(hourLabel, LV_PART_MAIN);
+    _cf          = lv_display_get_color_format(disp);
+    if (!allocateCells(hourLabel)) return false;
+
+    _canvas = lv_canvas_create(screen);
+    lv_obj_add_flag(_canvas, LV_OBJ_FLAG_HIDDEN);
+
+    // Below the seconds colon, in the labels' place
+    int32_t index = lv_obj_get_index(hourLabel);
+    for (int i = 0; i < 4; i++) {
+        _images[i] = lv_image_create(screen);
+        lv_obj_remove_flag(_images[i], LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_move_to_index(_images[i], index + i);
+    }
+    lv_obj_add_flag(hourLabel,   LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(minuteLabel, LV_OBJ_FLAG_HIDDEN);
+
+    _cached = true;
+    Serial.printf("✓ Digit cache: %d × %u B cells (%dpx high)\n",
+                  TIME_DIGIT_SLOTS, (unsigned)_slotBytes, (int)_cellH);
+    return true;
+}
+
+void time_digits_set(int hour, int minute) {
+    int wanted[4] = { hour / 10, hour % 10, minute / 10, minute % 10 };
+    if (memcmp(wanted, _shown, sizeof(wanted)) == 0) return;
+
+    if (!_cached) {
+        static char buf[2][3];
+        for (int pair = 0; pair < 2; pair++) {
+            if (!_labels[pair] || (wanted[pair * 2] == _shown[pair * 2] && wanted[pair * 2 + 1] == _shown[pair * 2 + 1])) continue;
+            snprintf(buf[pair], sizeof(buf[pair]), "%d%d", wanted[pair * 2], wanted[pair * 2 + 1]);
+            lv_label_set_text_static(_labels[pair], buf[pair]);
+        }
+    } else {
+        for (int i = 0; i < 4; i++) {
+            DigitSlot* s = slotFor(wanted[i], wanted);
+            lv_image_set_src(_images[i], &s->buf);
+        }
+        placePair(0, wanted[0], wanted[1]);
+        placePair(1, wanted[2], wanted[3]);
+    }
+    memcpy(_shown, wanted, sizeof(wanted));
+    _pending = true;
+}
+
+bool time_digits_cached() { return _cached; }
+
+void time_digits_report() {
+    if (_cached) {
+        Serial.printf("Digits: cache %d × %u B | %lu hits %lu renders (avg %lu us, max %lu us)",
+                      TIME_DIGIT_SLOTS, (unsigned)_slotBytes,
+                      (unsigned long)_stats.hits, (unsigned long)_stats.renders,
+                      (unsigned long)(_stats.renders ? _stats.render_us / _stats.renders : 0),
+                      (unsigned long)_stats.renderMax_us);
+    } else {
+        Serial.print("Digits: labels");
+    }
+    Serial.printf(" | update frame avg %lu us max %lu us (%lu)\n",
+                  (unsigned long)(_stats.updates ? _stats.update_us / _stats.updates : 0),
+                  (unsigned long)_stats.updateMax_us, (unsigned long)_stats.updates);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+// ─── Time screen digit cache ────────────────────────────────
+// ui_LabelHour / ui_LabelMinutes draw 150 px 4bpp glyphs, so every redraw of
+// either label (minute change, screen load, anything overlapping them)
+// re-blends up to ~60k anti-aliased pixels per digit. With the cache on, each
+// digit is rendered once into an opaque cell in the display's colour format
+// (RGB565_SWAPPED on the ST7789) with the 0x0F0F0F background baked in, and
+// the labels are replaced by image widgets that LVGL copies straight into the
+// draw buffer without converting a pixel.
+//
+// All ten digits would need ~170 KB, more than the C3 has next to the LVGL
+// pool and WiFi, so TIME_DIGIT_SLOTS cells are kept in LRU order. The four
+// visible digits are pinned, so a minute change costs at most the digits
+// that actually changed and a screen load costs none. If the cells can't be
+// allocated the labels stay in use, only updated when their text changes.
+// time_digits_report() prints the update-frame cost of whichever path is
+// active; build with TIME_DIGIT_CACHE 0 for the label figures.
+#ifndef TIME_DIGIT_CACHE
+#define TIME_DIGIT_CACHE     1
+#endif
+#define TIME_DIGIT_SLOTS     4           // ≥ 4, one per visible digit
+#define TIME_DIGIT_MIN_HEAP  40000       // free heap to leave after allocating the cells
+
+// ─── Public API ─────────────────────────────────────────────
+bool time_digits_begin(lv_display_t* disp, lv_obj_t* hourLabel, lv_obj_t* minuteLabel);   // false = label path
+void time_digits_set(int hour, int minute);     // no-op if unchanged
+bool time_digits_cached();
+void time_digits_report();
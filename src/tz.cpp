@@ -0,0 +1,122 @@
+#include "tz.h"
+
+// POSIX "Mm.w.d/t": month 1-12, week 1-5 (5 = last), weekday 0 = Sunday,
+// t = local wall-clock minute of the change.
+struct TzRule {
+    uint8_t month;
+    uint8_t week;
+    uint8_t wday;
+    int16_t minute;
+};
+
+struct TzZone {
+    const char* name;
+    const char* posix;      // for reference only
+    int16_t     std_min;    // minutes east of UTC
+    int16_t     dst_min;    // minutes east of UTC while DST is active
+    bool        has_dst;
+    TzRule      start;      // in local standard time
+    TzRule      end;        // in local daylight time
+};
+
+// ─── Zone table ─────────────────────────────────────────────
+static const TzZone zones[] = {
+    { "UTC",                 "UTC0",                              0,    0, false, {},               {}              },
+    { "Asia/Kolkata",        "IST-5:30",                        330,  330, false, {},               {}              },
+    { "Asia/Dubai",          "<+04>-4",                         240,  240, false, {},               {}              },
+    { "Asia/Singapore",      "<+08>-8",                         480,  480, false, {},               {}              },
+    { "Asia/Tokyo",          "JST-9",                           540,  540, false, {},               {}              },
+    { "Europe/London",       "GMT0BST,M3.5.0/1,M10.5.0",          0,   60, true,  { 3, 5, 0,  60 }, { 10, 5, 0, 120 } },
+    { "Europe/Berlin",       "CET-1CEST,M3.5.0,M10.5.0/3",       60,  120, true,  { 3, 5, 0, 120 }, { 10, 5, 0, 180 } },
+    { "America/New_York",    "EST5EDT,M3.2.0,M11.1.0",         -300, -240, true,  { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },
+    { "America/Chicago",     "CST6CDT,M3.2.0,M11.1.0",         -360, -300, true,  { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },
+    { "America/Los_Angeles", "PST8PDT,M3.2.0,M11.1.0",         -480, -420, true,  { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },
+    { "Australia/Sydney",    "AEST-10AEDT,M10.1.0,M4.1.0/3",    600,  660, true,  { 10, 1, 0, 120 }, { 4, 1, 0, 180 } },
+};
+#define TZ_ZONE_COUNT (sizeof(zones) / sizeof(zones[0]))
+
+static const TzZone* _zone = &zones[0];
+
+// Transition cache for one year: the year's bounds in local standard time and
+// both transition instants in UTC
+static time_t _yearBegin = 1;
+static time_t _yearEnd   = 0;
+static time_t _dstStart  = 0;
+static time_t _dstEnd    = 0;
+
+// ─── Calendar helpers ───────────────────────────────────────
+// Days since 1970-01-01 for a proleptic Gregorian date (H. Hinnant's algorithm)
+static int32_t daysFromCivil(int y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int32_t  era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned)(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int32_t)doe - 719468;
+}
+
+static int daysInMonth(int y, int m) {
+    static const uint8_t dim[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return (m == 2 && leap) ? 29 : dim[m - 1];
+}
+
+static int yearOf(time_t t) {
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    return tm.tm_year + 1900;
+}
+
+// Local wall-clock instant of a rule in a given year, as seconds since epoch
+static time_t ruleLocal(const TzRule& r, int year) {
+    int32_t first = daysFromCivil(year, r.month, 1);
+    int     wdFirst = (int)((first + 4) % 7 + 7) % 7;        // 1970-01-01 was a Thursday
+    int     day = 1 + (r.wday - wdFirst + 7) % 7 + (r.week - 1) * 7;
+    while (day > daysInMonth(year, r.month)) day -= 7;
+    return (time_t)(first + day - 1) * 86400 + (time_t)r.minute * 60;
+}
+
+static void cacheYear(int year) {
+    _yearBegin = (time_t)daysFromCivil(year,     1, 1) * 86400;
+    _yearEnd   = (time_t)daysFromCivil(year + 1, 1, 1) * 86400;
+    if (!_zone->has_dst) return;
+    _dstStart = ruleLocal(_zone->start, year) - (time_t)_zone->std_min * 60;
+    _dstEnd   = ruleLocal(_zone->end,   year) - (time_t)_zone->dst_min * 60;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+bool tz_set(const char* name) {
+    for (size_t i = 0; i < TZ_ZONE_COUNT; i++) {
+        if (strcmp(zones[i].name, name) == 0) {
+            _zone      = &zones[i];
+            _yearBegin = 1;
+            _yearEnd   = 0;
+            return true;
+        }
+    }
+    _zone      = &zones[0];
+    _yearBegin = 1;
+    _yearEnd   = 0;
+    return false;
+}
+
+const char* tz_name() { return _zone->name; }
+
+bool tz_is_dst(time_t utc) {
+    if (!_zone->has_dst) return false;
+    time_t local = utc + (time_t)_zone->std_min * 60;
+    if (local < _yearBegin || local >= _yearEnd) cacheYear(yearOf(local));
+    if (_dstStart < _dstEnd) return utc >= _dstStart && utc < _dstEnd;   // northern hemisphere
+    return utc >= _dstStart || utc < _dstEnd;                             // southern: DST spans new year
+}
+
+int32_t tz_offset_sec(time_t utc) {
+    return (int32_t)(tz_is_dst(utc) ? _zone->dst_min : _zone->std_min) * 60;
+}
+
+void tz_localtime(time_t utc, struct tm* out) {
+    bool   dst   = tz_is_dst(utc);
+    time_t local = utc + (time_t)(dst ? _zone->dst_min : _zone->std_min) * 60;
+    gmtime_r(&local, out);
+    out->tm_isdst = dst;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <Arduino.h>
+#include <time.h>
+
+// ─── Timezone engine ────────────────────────────────────────
+// The zones live in a compiled table (see tz.cpp) holding the already-parsed
+// fields of each POSIX TZ rule, so nothing is parsed at runtime. The two DST
+// transitions of the current year are computed once and cached, which makes
+// every UTC → local conversion a couple of compares and an add.
+// The RTC and the system clock are kept in UTC; only the display is local.
+
+// ─── Public API ─────────────────────────────────────────────
+bool        tz_set(const char* name);              // false (and UTC) if the zone is unknown
+const char* tz_name();
+int32_t     tz_offset_sec(time_t utc);             // total UTC offset incl. DST
+bool        tz_is_dst(time_t utc);
+void        tz_localtime(time_t utc, struct tm* out);
@@ -4,6 +4,7 @@
 // Project name: LCD_Screen
 
 #include "ui.h"
+#include "../ui_anim_pool.h"
 #include "ui_helpers.h"
 
 ///////////////////// VARIABLES ////////////////////
@@ -25,74 +26,77 @@ lv_obj_t * ui____initial_actions0;
 lv_anim_t * RotatingSun_Animation(lv_obj_t * TargetObject, int delay)
 {
     lv_anim_t * out_anim;
-    ui_anim_user_data_t * PropertyAnimation_0_user_data = lv_malloc(sizeof(ui_anim_user_data_t));
+    ui_anim_user_data_t * PropertyAnimation_0_user_data = ui_anim_user_data_alloc();
     PropertyAnimation_0_user_data->target = TargetObject;
     PropertyAnimation_0_user_data->val = -1;
     lv_anim_t PropertyAnimation_0;
     lv_anim_init(&PropertyAnimation_0);
+    lv_anim_set_var(&PropertyAnimation_0, TargetObject);
     lv_anim_set_duration(&PropertyAnimation_0, 2000);
     lv_anim_set_user_data(&PropertyAnimation_0, PropertyAnimation_0_user_data);
     lv_anim_set_custom_exec_cb(&PropertyAnimation_0, _ui_anim_callback_set_image_angle);
     lv_anim_set_values(&PropertyAnimation_0, 0, 3600);
     lv_anim_set_path_cb(&PropertyAnimation_0, lv_anim_path_linear);
     lv_anim_set_delay(&PropertyAnimation_0, delay + 0);
-    lv_anim_set_deleted_cb(&PropertyAnimation_0, _ui_anim_callback_free_user_data);
+    lv_anim_set_deleted_cb(&PropertyAnimation_0, ui_anim_free_user_data);
     lv_anim_set_reverse_duration(&PropertyAnimation_0, 0);
     lv_anim_set_reverse_delay(&PropertyAnimation_0, 0);
     lv_anim_set_repeat_count(&PropertyAnimation_0, LV_ANIM_REPEAT_INFINITE);
     lv_anim_set_repeat_delay(&PropertyAnimation_0, 0);
     lv_anim_set_early_apply(&PropertyAnimation_0, false);
     lv_anim_set_get_value_cb(&PropertyAnimation_0, &_ui_anim_callback_get_image_angle);
-    out_anim = lv_anim_start(&PropertyAnimation_0);
+    out_anim = ui_anim_start(&PropertyAnimation_0);
 
     return out_anim;
 }
 lv_anim_t * rotationtest_Animation(lv_obj_t * TargetObject, int delay)
 {
     lv_anim_t * out_anim;
-    ui_anim_user_data_t * PropertyAnimation_0_user_data = lv_malloc(sizeof(ui_anim_user_data_t));
+    ui_anim_user_data_t * PropertyAnimation_0_user_data = ui_anim_user_data_alloc();
     PropertyAnimation_0_user_data->target = TargetObject;
     PropertyAnimation_0_user_data->val = -1;
     lv_anim_t PropertyAnimation_0;
     lv_anim_init(&PropertyAnimation_0);
+    lv_anim_set_var(&PropertyAnimation_0, TargetObject);
     lv_anim_set_duration(&PropertyAnimation_0, 3000);
     lv_anim_set_user_data(&PropertyAnimation_0, PropertyAnimation_0_user_data);
     lv_anim_set_custom_exec_cb(&PropertyAnimation_0, _ui_anim_callback_set_image_angle);
     lv_anim_set_values(&PropertyAnimation_0, 0, 3600);
     lv_anim_set_path_cb(&PropertyAnimation_0, lv_anim_path_linear);
     lv_anim_set_delay(&PropertyAnimation_0, delay + 0);
-    lv_anim_set_deleted_cb(&PropertyAnimation_0, _ui_anim_callback_free_user_data);
+    lv_anim_set_deleted_cb(&PropertyAnimation_0, ui_anim_free_user_data);
     lv_anim_set_reverse_duration(&PropertyAnimation_0, 0);
     lv_anim_set_reverse_delay(&PropertyAnimation_0, 0);
     lv_anim_set_repeat_count(&PropertyAnimation_0, LV_ANIM_REPEAT_INFINITE);
     lv_anim_set_repeat_delay(&PropertyAnimation_0, 0);
     lv_anim_set_early_apply(&PropertyAnimation_0, false);
     lv_anim_set_get_value_cb(&PropertyAnimation_0, &_ui_anim_callback_get_image_angle);
-    out_anim = lv_anim_start(&PropertyAnimation_0);
+    out_anim = ui_anim_start(&PropertyAnimation_0);
 
     return out_anim;
 }
 lv_anim_t * Blink_Animation(lv_obj_t * TargetObject, int delay)
 {
     lv_anim_t * out_anim;
-    ui_anim_user_data_t * PropertyAnimation_0_user_data = lv_malloc(sizeof(ui_anim_user_data_t));
+    ui_anim_user_data_t * PropertyAnimation_0_user_data = ui_anim_user_data_alloc();
     PropertyAnimation_0_user_data->target = TargetObject;
     PropertyAnimation_0_user_data->val = -1;
     lv_anim_t PropertyAnimation_0;
     lv_anim_init(&PropertyAnimation_0);
+    lv_anim_set_var(&PropertyAnimation_0, TargetObject);
     lv_anim_set_duration(&PropertyAnimation_0, 500);
     lv_anim_set_user_data(&PropertyAnimation_0, PropertyAnimation_0_user_data);
     lv_anim_set_custom_exec_cb(&PropertyAnimation_0, _ui_anim_callback_set_opacity);
     lv_anim_set_values(&PropertyAnimation_0, 0, 255);
     lv_anim_set_path_cb(&PropertyAnimation_0, lv_anim_path_ease_in);
     lv_anim_set_delay(&PropertyAnimation_0, delay + 0);
-    lv_anim_set_deleted_cb(&PropertyAnimation_0, _ui_anim_callback_free_user_data);
+    lv_anim_set_deleted_cb(&PropertyAnimation_0, ui_anim_free_user_data);
     lv_anim_set_reverse_duration(&PropertyAnimation_0, 250);
     lv_anim_set_reverse_delay(&PropertyAnimation_0, 250);
     lv_anim_set_repeat_count(&PropertyAnimation_0, LV_ANIM_REPEAT_INFINITE);
     lv_anim_set_repeat_delay(&PropertyAnimation_0, 0);
     lv_anim_set_early_apply(&PropertyAnimation_0, true);
-    out_anim = lv_anim_start(&PropertyAnimation_0);
+    out_anim = ui_anim_start(&PropertyAnimation_0);
 
     return out_anim;
 }
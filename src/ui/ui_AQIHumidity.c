@@ -5,6 +5,7 @@
 
 #include "ui.h"
 
+lv_obj_t * ui_AQIPollutant;
 lv_obj_t * ui_OutdoorHumidityIcon;
 lv_obj_t * ui_AQI;
 lv_obj_t * ui_AQIIcon;
@@ -15,6 +16,7 @@ lv_obj_t * ui_OutdoorHumidity = NULL;
 lv_obj_t * ui_AQIIcon = NULL;
 lv_obj_t * ui_AQI = NULL;
 lv_obj_t * ui_OutdoorHumidityIcon = NULL;
+lv_obj_t * ui_AQIPollutant = NULL;
 // event funtions
 
 // build funtions
@@ -72,11 +74,22 @@ void ui_AQIHumidity_screen_init(void)
     lv_obj_add_flag(ui_OutdoorHumidityIcon, LV_OBJ_FLAG_CLICKABLE);     /// Flags
     lv_obj_remove_flag(ui_OutdoorHumidityIcon, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
 
+    ui_AQIPollutant = lv_label_create(ui_AQIHumidity);
+    lv_obj_set_width(ui_AQIPollutant, LV_SIZE_CONTENT);   /// 1
+    lv_obj_set_height(ui_AQIPollutant, LV_SIZE_CONTENT);    /// 1
+    lv_obj_set_x(ui_AQIPollutant, -83);
+    lv_obj_set_y(ui_AQIPollutant, 108);
+    lv_obj_set_align(ui_AQIPollutant, LV_ALIGN_CENTER);
+    lv_label_set_text(ui_AQIPollutant, "PM2.5");
+    lv_obj_set_style_text_color(ui_AQIPollutant, lv_color_hex(0xA9B4C2), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_opa(ui_AQIPollutant, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+
     ui_AQIHumidity = ui_AQIHumidity;
     ui_OutdoorHumidity = ui_OutdoorHumidity;
     ui_AQIIcon = ui_AQIIcon;
     ui_AQI = ui_AQI;
     ui_OutdoorHumidityIcon = ui_OutdoorHumidityIcon;
+    ui_AQIPollutant = ui_AQIPollutant;
 
 }
 
@@ -95,5 +108,7 @@ void ui_AQIHumidity_screen_destroy(void)
     ui_AQI = NULL;
     ui_OutdoorHumidityIcon = NULL;
     ui_OutdoorHumidityIcon = NULL;
+    ui_AQIPollutant = NULL;
+    ui_AQIPollutant = NULL;
 
 }
@@ -18,12 +18,14 @@ extern lv_obj_t * ui_OutdoorHumidity;
 extern lv_obj_t * ui_AQIIcon;
 extern lv_obj_t * ui_AQI;
 extern lv_obj_t * ui_OutdoorHumidityIcon;
+extern lv_obj_t * ui_AQIPollutant;
 // CUSTOM VARIABLES
 extern lv_obj_t * ui_AQIHumidity;
 extern lv_obj_t * ui_OutdoorHumidity;
 extern lv_obj_t * ui_AQIIcon;
 extern lv_obj_t * ui_AQI;
 extern lv_obj_t * ui_OutdoorHumidityIcon;
+extern lv_obj_t * ui_AQIPollutant;
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -0,0 +1,56 @@
+#include "ui_anim_pool.h"
+
+static ui_anim_user_data_t  _pool[UI_ANIM_POOL_SIZE];
+static bool                 _used[UI_ANIM_POOL_SIZE];
+static ui_anim_pool_stats_t _stats = {};
+
+// ─── Helpers ─────────────────────────────────────────────────
+static lv_obj_tree_walk_res_t releaseCb(lv_obj_t* obj, void* user_data) {
+    LV_UNUSED(user_data);
+    lv_anim_delete(obj, NULL);
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+ui_anim_user_data_t* ui_anim_user_data_alloc(void) {
+    for (int i = 0; i < UI_ANIM_POOL_SIZE; i++) {
+        if (_used[i]) continue;
+        _used[i] = true;
+        _stats.used++;
+        if (_stats.used > _stats.peak) _stats.peak = _stats.used;
+        lv_memzero(&_pool[i], sizeof(ui_anim_user_data_t));
+        return &_pool[i];
+    }
+    _stats.heap_fallbacks++;
+    return (ui_anim_user_data_t*)lv_malloc_zeroed(sizeof(ui_anim_user_data_t));
+}
+
+void ui_anim_free_user_data(lv_anim_t* a) {
+    ui_anim_user_data_t* usr = (ui_anim_user_data_t*)a->user_data;
+    if (usr >= &_pool[0] && usr < &_pool[UI_ANIM_POOL_SIZE]) {
+        _used[usr - _pool] = false;
+        _stats.used--;
+    } else {
+        lv_free(usr);
+    }
+    a->user_data = NULL;
+}
+
+lv_anim_t* ui_anim_start(lv_anim_t* a) {
+    _stats.starts++;
+    lv_anim_t* running = lv_anim_get(a->var, NULL);
+    if (running && running->custom_exec_cb == a->custom_exec_cb && running->exec_cb == a->exec_cb) {
+        _stats.reused++;
+        if (a->deleted_cb) a->deleted_cb(a);    // the copy never started, hand its user data back
+        return running;
+    }
+    return lv_anim_start(a);
+}
+
+void ui_anim_release_screen(lv_obj_t* screen) {
+    if (screen) lv_obj_tree_walk(screen, releaseCb, NULL);
+}
+
+void ui_anim_pool_get_stats(ui_anim_pool_stats_t* out) {
+    *out = _stats;
+}
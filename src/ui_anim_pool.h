@@ -0,0 +1,36 @@
+#pragma once
+#include <lvgl.h>
+#include "ui/ui_helpers.h"
+
+// ─── SquareLine animation pool ──────────────────────────────
+// The generated *_Animation() functions lv_malloc a ui_anim_user_data_t on
+// every start. These replacements take it from a fixed pool, with lv_malloc
+// only as a counted fallback. They also set the target as the anim var, so
+// lv_anim_delete(obj, NULL) reaches them and LVGL drops them with their
+// object, and they return the running handle instead of starting the same
+// animation on the same target twice.
+//
+// The generated ui.c has to call them, which an export undoes: run
+// tools/ui_export_patch.py after every export (see src/ui/PATCHES.md).
+#define UI_ANIM_POOL_SIZE 8
+
+typedef struct {
+    uint32_t used;
+    uint32_t peak;
+    uint32_t heap_fallbacks;
+    uint32_t starts;
+    uint32_t reused;        // starts that found the same animation already running
+} ui_anim_pool_stats_t;
+
+// ─── Public API ─────────────────────────────────────────────
+#ifdef __cplusplus
+extern "C" {
+#endif
+ui_anim_user_data_t* ui_anim_user_data_alloc(void);     // replaces lv_malloc(sizeof(ui_anim_user_data_t))
+void                 ui_anim_free_user_data(lv_anim_t* a);   // deleted_cb, replaces _ui_anim_callback_free_user_data
+lv_anim_t*           ui_anim_start(lv_anim_t* a);       // replaces lv_anim_start
+void                 ui_anim_release_screen(lv_obj_t* screen);   // deletes the anims of a screen and its children
+void                 ui_anim_pool_get_stats(ui_anim_pool_stats_t* out);
+#ifdef __cplusplus
+}
+#endif
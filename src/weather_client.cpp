@@ -0,0 +1,116 @@
+#include "weather_client.h"
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <esp_timer.h>
+
+static const WeatherProvider*  _provider  = &weatherapi_provider;
+static const WeatherTransport* _transport = &weather_http_transport;
+static char                    _url[WEATHER_URL_MAX] = "";
+static long                    _updatedAt = -1;     // observation currently on screen
+static unsigned long           _nextDelay = WEATHER_INTERVAL_MS;
+static WeatherClientStats      _stats     = {};
+
+static const char* const resultNames[WEATHER_RESULT_COUNT] = {
+    "ok", "unchanged", "no link", "transport", "http", "parse"
+};
+
+// ─── Helpers ─────────────────────────────────────────────────
+static int httpGet(const char* url, String& body, uint32_t timeout_ms) {
+    HTTPClient http;
+    http.setTimeout(timeout_ms);
+    if (!http.begin(url)) return HTTPC_ERROR_CONNECTION_REFUSED;
+    int code = http.GET();
+    if (code == HTTP_CODE_OK) body = http.getString();
+    http.end();
+    return code;
+}
+
+// Next fetch just after the upstream refresh, measured on the server's clock
+// so the local clock being off does not matter.
+static unsigned long scheduleFrom(long updated, long server) {
+    if (updated <= 0 || server <= 0) return WEATHER_INTERVAL_MS;
+    long due = updated + WEATHER_UPSTREAM_PERIOD + WEATHER_FETCH_MARGIN - server;
+    unsigned long ms = due > 0 ? (unsigned long)due * 1000UL : WEATHER_RETRY_MS;
+    return constrain(ms, (unsigned long)WEATHER_MIN_INTERVAL_MS, (unsigned long)WEATHER_MAX_INTERVAL_MS);
+}
+
+static WeatherResult finish(WeatherResult r, unsigned long nextDelay) {
+    _stats.results[r]++;
+    _nextDelay = nextDelay;
+    return r;
+}
+
+const WeatherTransport weather_http_transport = { "http", httpGet };
+
+// ─── Public ─────────────────────────────────────────────────
+void weather_client_begin(const WeatherProvider* provider, const WeatherTransport* transport,
+                          const char* base, const char* key, const char* location) {
+    _provider  = provider;
+    _transport = transport;
+    _updatedAt = -1;
+    if (!_provider->buildUrl(_url, sizeof(_url), base ? base : _provider->defaultBase, key, location)) {
+        _url[0] = '\0';
+        Serial.println("✗ Weather URL too long");
+        return;
+    }
+    Serial.printf("✓ Weather: %s via %s (%s)\n", _provider->name, _transport->name,
+                  base ? base : _provider->defaultBase);
+}
+
+WeatherResult weather_client_fetch(WeatherSample& out) {
+    if (!_url[0])                       return finish(WEATHER_TRANSPORT, WEATHER_MAX_INTERVAL_MS);
+    if (WiFi.status() != WL_CONNECTED)  return finish(WEATHER_NO_LINK,   WEATHER_RETRY_MS);
+
+    String body;
+    unsigned long start = millis();
+    int status = _transport->get(_url, body, WEATHER_HTTP_TIMEOUT_MS);
+    _stats.lastStatus   = status;
+    _stats.fetchLast_ms = millis() - start;
+    _stats.fetchMax_ms  = max(_stats.fetchMax_ms, _stats.fetchLast_ms);
+    _stats.fetchSum_ms += _stats.fetchLast_ms;
+    Serial.printf("← Weather %d (%lums)\n", status, (unsigned long)_stats.fetchLast_ms);
+
+    if (status < 0)             return finish(WEATHER_TRANSPORT,   WEATHER_RETRY_MS);
+    if (status != HTTP_CODE_OK) return finish(WEATHER_HTTP_STATUS, WEATHER_RETRY_MS);
+
+    _stats.bytesLast   = body.length();
+    _stats.bytesTotal += body.length();
+
+    long updated, server;
+    _provider->peek(body.c_str(), body.length(), &updated, &server);
+    unsigned long next = scheduleFrom(updated, server);
+    if (updated > 0 && updated == _updatedAt) return finish(WEATHER_UNCHANGED, next);
+
+    int64_t t0 = esp_timer_get_time();
+    bool ok = _provider->parse(body.c_str(), body.length(), out);
+    _stats.parseLast_us = (uint32_t)(esp_timer_get_time() - t0);
+    _stats.parseMax_us  = max(_stats.parseMax_us, _stats.parseLast_us);
+    _stats.parseSum_us += _stats.parseLast_us;
+    if (!ok) return finish(WEATHER_PARSE, WEATHER_RETRY_MS);
+
+    _updatedAt = updated;
+    return finish(WEATHER_OK, next);
+}
+
+unsigned long weather_client_next_delay_ms() { return _nextDelay; }
+
+const WeatherClientStats& weather_client_stats() { return _stats; }
+
+const char* weather_result_name(WeatherResult r) {
+    return r < WEATHER_RESULT_COUNT ? resultNames[r] : "?";
+}
+
+void weather_client_report() {
+    const uint32_t* n = _stats.results;
+    uint32_t fetched = n[WEATHER_OK] + n[WEATHER_UNCHANGED] + n[WEATHER_HTTP_STATUS]
+                     + n[WEATHER_TRANSPORT] + n[WEATHER_PARSE];
+    uint32_t parsed  = n[WEATHER_OK] + n[WEATHER_PARSE];
+    Serial.printf("Weather: ok %lu unchanged %lu | fail link %lu transport %lu http %lu parse %lu (last %d) | "
+                  "%lu B last %llu B total | fetch avg %lu max %lu ms | parse avg %lu max %lu us\n",
+                  (unsigned long)n[WEATHER_OK], (unsigned long)n[WEATHER_UNCHANGED],
+                  (unsigned long)n[WEATHER_NO_LINK], (unsigned long)n[WEATHER_TRANSPORT],
+                  (unsigned long)n[WEATHER_HTTP_STATUS], (unsigned long)n[WEATHER_PARSE], _stats.lastStatus,
+                  (unsigned long)_stats.bytesLast, (unsigned long long)_stats.bytesTotal,
+                  (unsigned long)(fetched ? _stats.fetchSum_ms / fetched : 0), (unsigned long)_stats.fetchMax_ms,
+                  (unsigned long)(parsed ? _stats.parseSum_us / parsed : 0), (unsigned long)_stats.parseMax_us);
+}
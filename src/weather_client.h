@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+#include "weather_provider.h"
+
+// ─── Weather client ─────────────────────────────────────────
+// Glues a transport to a provider: builds the URL, fetches, skips the parse
+// when the upstream data has not changed, and schedules the next fetch just
+// after the provider's expected refresh. Latency, parse time, bytes and
+// failures are tracked per stage so a replay server run gives comparable
+// numbers to the live service.
+#define WEATHER_INTERVAL_MS      600000     // fallback when the response carries no timestamps
+#define WEATHER_UPSTREAM_PERIOD  900        // s, weatherapi.com refreshes current conditions ~every 15 min
+#define WEATHER_FETCH_MARGIN     60         // s, fetch this long after the expected refresh
+#define WEATHER_RETRY_MS         120000     // data not refreshed yet or request failed
+#define WEATHER_MIN_INTERVAL_MS  60000
+#define WEATHER_MAX_INTERVAL_MS  1800000
+#define WEATHER_HTTP_TIMEOUT_MS  5000
+#define WEATHER_URL_MAX          200
+
+struct WeatherTransport {
+    const char* name;
+    // Fetches url into body. Returns the HTTP status, or a negative
+    // transport error (connection refused, timeout, …).
+    int (*get)(const char* url, String& body, uint32_t timeout_ms);
+};
+
+enum WeatherResult {
+    WEATHER_OK          = 0,    // new sample parsed
+    WEATHER_UNCHANGED   = 1,    // same observation as last time, not parsed
+    WEATHER_NO_LINK     = 2,
+    WEATHER_TRANSPORT   = 3,    // connect/timeout/read error
+    WEATHER_HTTP_STATUS = 4,    // server answered with a non-200 status
+    WEATHER_PARSE       = 5,
+    WEATHER_RESULT_COUNT = 6
+};
+
+struct WeatherClientStats {
+    uint32_t results[WEATHER_RESULT_COUNT];
+    int      lastStatus;                // HTTP status or transport error of the last request
+    uint32_t bytesLast;
+    uint64_t bytesTotal;
+    uint32_t fetchLast_ms;
+    uint32_t fetchMax_ms;
+    uint64_t fetchSum_ms;
+    uint32_t parseLast_us;
+    uint32_t parseMax_us;
+    uint64_t parseSum_us;
+};
+
+// ─── Public API ─────────────────────────────────────────────
+extern const WeatherTransport weather_http_transport;    // HTTPClient
+
+// base may be NULL for the provider's default (override it to point at a replay server)
+void                      weather_client_begin(const WeatherProvider* provider, const WeatherTransport* transport,
+                                               const char* base, const char* key, const char* location);
+WeatherResult             weather_client_fetch(WeatherSample& out);    // out only written on WEATHER_OK
+unsigned long             weather_client_next_delay_ms();              // from the last fetch
+const WeatherClientStats& weather_client_stats();
+const char*               weather_result_name(WeatherResult r);
+void                      weather_client_report();
@@ -0,0 +1,99 @@
+#include "weather_provider.h"
+#include <ArduinoJson.h>
+
+// ─── Helpers ─────────────────────────────────────────────────
+// Finds "key": <number> anywhere in the body. Good enough for the flat,
+// unique timestamp fields; everything else goes through the JSON parser.
+static long scanLong(const char* body, size_t len, const char* key) {
+    size_t klen = strlen(key);
+    for (size_t i = 0; i + klen + 1 < len; i++) {
+        if (body[i] != '"' || memcmp(body + i + 1, key, klen) != 0 || body[i + 1 + klen] != '"') continue;
+        const char* p   = body + i + klen + 2;
+        const char* end = body + len;
+        while (p < end && (*p == ' ' || *p == ':')) p++;
+        if (p >= end || !isdigit((unsigned char)*p)) return -1;
+        long v = 0;
+        while (p < end && isdigit((unsigned char)*p)) v = v * 10 + (*p++ - '0');
+        return v;
+    }
+    return -1;
+}
+
+// ─── weatherapi.com ──────────────────────────────────────────
+static bool weatherapiUrl(char* out, size_t len, const char* base, const char* key, const char* location) {
+    char q[96];
+    if (!url_encode(q, sizeof(q), location)) return false;
+    int n = snprintf(out, len, "%s/v1/current.json?key=%s&q=%s&aqi=yes", base, key, q);
+    return n > 0 && (size_t)n < len;
+}
+
+static void weatherapiPeek(const char* body, size_t len, long* updated, long* server) {
+    *updated = scanLong(body, len, "last_updated_epoch");
+    *server  = scanLong(body, len, "localtime_epoch");
+}
+
+static bool weatherapiParse(const char* body, size_t len, WeatherSample& out) {
+    // Only the fields below are kept, which keeps the document a few hundred
+    // bytes no matter how much the service sends.
+    JsonDocument filter;
+    filter["location"]["localtime_epoch"]       = true;
+    JsonObject cur = filter["current"].to<JsonObject>();
+    cur["last_updated_epoch"]   = true;
+    cur["temp_c"]               = true;
+    cur["humidity"]             = true;
+    cur["is_day"]               = true;
+    cur["condition"]["code"]    = true;
+    cur["air_quality"]          = true;
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, body, len, DeserializationOption::Filter(filter));
+    if (error) {
+        Serial.printf("✗ JSON error: %s\n", error.c_str());
+        return false;
+    }
+    JsonObject c = doc["current"];
+    if (c.isNull() || !c["temp_c"].is<float>() || !c["condition"]["code"].is<int>()) return false;
+
+    out.temp_c        = c["temp_c"].as<float>();
+    out.humidity      = c["humidity"].as<float>();
+    out.code          = c["condition"]["code"].as<int>();
+    out.is_day        = c["is_day"] | 1;
+    out.updated_epoch = c["last_updated_epoch"] | -1L;
+    out.server_epoch  = doc["location"]["localtime_epoch"] | -1L;
+
+    static const char* const keys[AQI_POLLUTANT_COUNT] = { "pm2_5", "pm10", "no2", "o3", "so2", "co" };
+    JsonObject aq = c["air_quality"];
+    out.has_aqi = !aq.isNull();
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++)
+        out.conc[p] = aq[keys[p]].is<float>() ? aqi_conc(aq[keys[p]].as<float>()) : AQI_MISSING;
+    return true;
+}
+
+const WeatherProvider weatherapi_provider = {
+    "weatherapi.com",
+    "http://api.weatherapi.com",
+    weatherapiUrl,
+    weatherapiPeek,
+    weatherapiParse
+};
+
+// ─── Public ─────────────────────────────────────────────────
+size_t url_encode(char* out, size_t len, const char* in) {
+    static const char hex[] = "0123456789ABCDEF";
+    size_t n = 0;
+    for (; *in; in++) {
+        unsigned char c = *in;
+        bool plain = isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~' || c == ',';
+        size_t need = plain ? 1 : 3;
+        if (n + need >= len) return 0;
+        if (plain) {
+            out[n++] = c;
+        } else {
+            out[n++] = '%';
+            out[n++] = hex[c >> 4];
+            out[n++] = hex[c & 0x0F];
+        }
+    }
+    out[n] = '\0';
+    return n;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <Arduino.h>
+#include "aqi.h"
+
+// ─── Weather providers ──────────────────────────────────────
+// A provider knows one service's URL scheme and response format and turns a
+// response body into a WeatherSample. It never touches the network or the
+// UI, so the same parser runs against live responses, recorded ones replayed
+// by tools/weather_replay.py, or a buffer on a host build.
+struct WeatherSample {
+    float   temp_c;
+    float   humidity;                       // %RH
+    int     code;                           // weatherapi.com condition code (see weather_theme.h)
+    int     is_day;
+    long    updated_epoch;                  // upstream observation time, -1 if unknown
+    long    server_epoch;                   // server clock when the response was built, -1 if unknown
+    bool    has_aqi;
+    int32_t conc[AQI_POLLUTANT_COUNT];      // 0.1 µg/m³, AQI_MISSING where not reported
+};
+
+struct WeatherProvider {
+    const char* name;
+    const char* defaultBase;                // scheme://host[:port], no trailing slash
+
+    // Returns false if the URL did not fit.
+    bool (*buildUrl)(char* out, size_t len, const char* base, const char* key, const char* location);
+
+    // Cheap timestamp scan without parsing the document. Either value may be -1.
+    void (*peek)(const char* body, size_t len, long* updated_epoch, long* server_epoch);
+
+    // Full parse. Returns false on malformed or incomplete data; out is then undefined.
+    bool (*parse)(const char* body, size_t len, WeatherSample& out);
+};
+
+// ─── Public API ─────────────────────────────────────────────
+extern const WeatherProvider weatherapi_provider;     // api.weatherapi.com current.json
+
+size_t url_encode(char* out, size_t len, const char* in);    // returns 0 if it did not fit
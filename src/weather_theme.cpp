@@ -0,0 +1,118 @@
+#include "weather_theme.h"
+#include "ui/ui.h"
+
+struct WeatherCode {
+    uint16_t code;
+    uint8_t  category;
+};
+
+// All documented weatherapi.com condition codes, sorted for binary search
+static const WeatherCode codes[] = {
+    { 1000, WX_CLEAR  },   // Sunny / Clear
+    { 1003, WX_CLOUDY },   // Partly cloudy
+    { 1006, WX_CLOUDY },   // Cloudy
+    { 1009, WX_CLOUDY },   // Overcast
+    { 1030, WX_FOG    },   // Mist
+    { 1063, WX_RAIN   },   // Patchy rain possible
+    { 1066, WX_SNOW   },   // Patchy snow possible
+    { 1069, WX_SNOW   },   // Patchy sleet possible
+    { 1072, WX_RAIN   },   // Patchy freezing drizzle possible
+    { 1087, WX_STORM  },   // Thundery outbreaks possible
+    { 1114, WX_SNOW   },   // Blowing snow
+    { 1117, WX_SNOW   },   // Blizzard
+    { 1135, WX_FOG    },   // Fog
+    { 1147, WX_FOG    },   // Freezing fog
+    { 1150, WX_RAIN   },   // Patchy light drizzle
+    { 1153, WX_RAIN   },   // Light drizzle
+    { 1168, WX_RAIN   },   // Freezing drizzle
+    { 1171, WX_RAIN   },   // Heavy freezing drizzle
+    { 1180, WX_RAIN   },   // Patchy light rain
+    { 1183, WX_RAIN   },   // Light rain
+    { 1186, WX_RAIN   },   // Moderate rain at times
+    { 1189, WX_RAIN   },   // Moderate rain
+    { 1192, WX_RAIN   },   // Heavy rain at times
+    { 1195, WX_RAIN   },   // Heavy rain
+    { 1198, WX_RAIN   },   // Light freezing rain
+    { 1201, WX_RAIN   },   // Moderate or heavy freezing rain
+    { 1204, WX_SNOW   },   // Light sleet
+    { 1207, WX_SNOW   },   // Moderate or heavy sleet
+    { 1210, WX_SNOW   },   // Patchy light snow
+    { 1213, WX_SNOW   },   // Light snow
+    { 1216, WX_SNOW   },   // Patchy moderate snow
+    { 1219, WX_SNOW   },   // Moderate snow
+    { 1222, WX_SNOW   },   // Patchy heavy snow
+    { 1225, WX_SNOW   },   // Heavy snow
+    { 1237, WX_SNOW   },   // Ice pellets
+    { 1240, WX_RAIN   },   // Light rain shower
+    { 1243, WX_RAIN   },   // Moderate or heavy rain shower
+    { 1246, WX_RAIN   },   // Torrential rain shower
+    { 1249, WX_SNOW   },   // Light sleet showers
+    { 1252, WX_SNOW   },   // Moderate or heavy sleet showers
+    { 1255, WX_SNOW   },   // Light snow showers
+    { 1258, WX_SNOW   },   // Moderate or heavy snow showers
+    { 1261, WX_SNOW   },   // Light showers of ice pellets
+    { 1264, WX_SNOW   },   // Moderate or heavy showers of ice pellets
+    { 1273, WX_STORM  },   // Patchy light rain with thunder
+    { 1276, WX_STORM  },   // Moderate or heavy rain with thunder
+    { 1279, WX_STORM  },   // Patchy light snow with thunder
+    { 1282, WX_STORM  },   // Moderate or heavy snow with thunder
+};
+#define WEATHER_CODE_COUNT (sizeof(codes) / sizeof(codes[0]))
+
+// [category][is_day]
+static const WeatherTheme themes[WX_COUNT][2] = {
+    /* CLEAR  */ { { &ui_MoonIcon,        0x0F1C2E, 0xFFFFFF, "Clear",  nullptr               },
+                   { &ui_SunIcon,         0x87CEEB, 0x000000, "Clear",  RotatingSun_Animation  } },
+    /* CLOUDY */ { { &ui_CloudyNightIcon, 0x95A5A6, 0xFFFFFF, "Cloudy", nullptr               },
+                   { &ui_CloudIcon,       0x95A5A6, 0x000000, "Cloudy", nullptr               } },
+    /* FOG    */ { { &ui_FogIcon,         0xBDC3C7, 0x000000, "Foggy",  nullptr               },
+                   { &ui_FogIcon,         0xBDC3C7, 0x000000, "Foggy",  nullptr               } },
+    /* RAIN   */ { { &ui_RainIcon,        0x34495E, 0xFFFFFF, "Rainy",  nullptr               },
+                   { &ui_RainIcon,        0x34495E, 0xFFFFFF, "Rainy",  nullptr               } },
+    /* SNOW   */ { { &ui_CloudyNightIcon, 0x5D6D7E, 0xFFFFFF, "Snowy",  nullptr               },
+                   { &ui_CloudIcon,       0xD6E4F0, 0x000000, "Snowy",  nullptr               } },
+    /* STORM  */ { { &ui_RainIcon,        0x1C2833, 0xFFFFFF, "Stormy", nullptr               },
+                   { &ui_RainIcon,        0x2C3E50, 0xFFFFFF, "Stormy", nullptr               } },
+};
+
+// Every icon a theme can show, hidden before the selected one is revealed
+static lv_obj_t** const icons[] = {
+    &ui_SunIcon, &ui_MoonIcon, &ui_CloudIcon, &ui_RainIcon, &ui_FogIcon, &ui_CloudyNightIcon
+};
+
+// ─── Public ─────────────────────────────────────────────────
+WeatherCategory weather_category(int code) {
+    int lo = 0, hi = (int)WEATHER_CODE_COUNT - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if      (codes[mid].code < code) lo = mid + 1;
+        else if (codes[mid].code > code) hi = mid - 1;
+        else return (WeatherCategory)codes[mid].category;
+    }
+    return WX_CLEAR;
+}
+
+const WeatherTheme& weather_theme(int code, int is_day) {
+    return themes[weather_category(code)][is_day ? 1 : 0];
+}
+
+void weather_theme_apply(int code, int is_day) {
+    const WeatherTheme& t = weather_theme(code, is_day);
+
+    if (ui_Outdoor_Weather) lv_obj_set_style_bg_color(ui_Outdoor_Weather, lv_color_hex(t.background), 0);
+
+    lv_color_t text = lv_color_hex(t.text);
+    if (ui_WeatherDesc) lv_obj_set_style_text_color(ui_WeatherDesc, text, 0);
+    if (ui_OutdoorTemp) lv_obj_set_style_text_color(ui_OutdoorTemp, text, 0);
+    if (ui_Celcious)    lv_obj_set_style_text_color(ui_Celcious,    text, 0);
+
+    for (lv_obj_t** icon : icons) {
+        if (!*icon) continue;
+        lv_obj_add_flag(*icon, LV_OBJ_FLAG_HIDDEN);
+        lv_anim_del(*icon, NULL);
+    }
+    if (*t.icon) {
+        lv_obj_clear_flag(*t.icon, LV_OBJ_FLAG_HIDDEN);
+        if (t.animation) t.animation(*t.icon, 0);
+    }
+}
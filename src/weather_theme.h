@@ -0,0 +1,29 @@
+#pragma once
+#include <lvgl.h>
+
+// ─── Weather condition themes ───────────────────────────────
+// Every weatherapi.com condition code maps to one category; each category
+// has a day and a night theme. One lookup gives everything the
+// Outdoor_Weather screen needs.
+enum WeatherCategory {
+    WX_CLEAR  = 0,
+    WX_CLOUDY = 1,
+    WX_FOG    = 2,
+    WX_RAIN   = 3,
+    WX_SNOW   = 4,
+    WX_STORM  = 5,
+    WX_COUNT  = 6
+};
+
+struct WeatherTheme {
+    lv_obj_t**  icon;                               // address of the ui_*Icon to show
+    uint32_t    background;
+    uint32_t    text;
+    const char* description;
+    lv_anim_t*  (*animation)(lv_obj_t*, int);       // optional, started on the icon
+};
+
+// ─── Public API ─────────────────────────────────────────────
+WeatherCategory     weather_category(int code);      // unknown codes fall back to WX_CLEAR
+const WeatherTheme& weather_theme(int code, int is_day);
+void                weather_theme_apply(int code, int is_day);   // configure ui_Outdoor_Weather
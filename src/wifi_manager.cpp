@@ -0,0 +1,173 @@
+#include "wifi_manager.h"
+#include <WiFi.h>
+#include <esp_wifi.h>
+
+static const char*   _ssid      = nullptr;
+static const char*   _password  = nullptr;
+static WifiState     _state     = WIFI_MGR_OFF;
+static unsigned long _stateSince = 0;
+static unsigned long _lastRssi  = 0;
+static bool          _linkUpPending = false;
+static uint8_t       _listenInterval = 0;      // 0 = driver default
+
+// Set from the WiFi event task, consumed in wifi_mgr_tick()
+static volatile bool    _evGotIp        = false;
+static volatile bool    _evDisconnected = false;
+static volatile uint8_t _evReason       = 0;
+
+static WifiStats _stats = {};
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+        _evGotIp = true;
+        break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+        _evReason       = info.wifi_sta_disconnected.reason;
+        _evDisconnected = true;
+        break;
+    default:
+        break;
+    }
+}
+
+static void setState(WifiState s) {
+    _state      = s;
+    _stateSince = millis();
+}
+
+static void startAttempt() {
+    WiFi.begin(_ssid, _password, 0, NULL, false);
+    if (_listenInterval) {
+        wifi_config_t conf;
+        esp_wifi_get_config(WIFI_IF_STA, &conf);
+        conf.sta.listen_interval = _listenInterval;
+        esp_wifi_set_config(WIFI_IF_STA, &conf);
+    }
+    esp_wifi_connect();
+    setState(WIFI_MGR_CONNECTING);
+}
+
+static void enterBackoff(bool failedAttempt) {
+    if (failedAttempt) _stats.failedAttempts++;
+    setState(WIFI_MGR_BACKOFF);
+    Serial.printf("✗ WiFi down (reason %u) — retry in %lus\n", _stats.lastReason,
+                  (unsigned long)(_stats.backoff_ms / 1000));
+}
+
+static void recordRssi() {
+    _stats.rssi[_stats.rssiHead] = (int8_t)WiFi.RSSI();
+    _stats.rssiHead = (_stats.rssiHead + 1) % WIFI_RSSI_HISTORY;
+    if (_stats.rssiCount < WIFI_RSSI_HISTORY) _stats.rssiCount++;
+}
+
+// ─── Public ─────────────────────────────────────────────────
+void wifi_mgr_begin(const char* ssid, const char* password) {
+    _ssid             = ssid;
+    _password         = password;
+    _stats.backoff_ms = WIFI_BACKOFF_MIN_MS;
+    WiFi.onEvent(onWiFiEvent);
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);    // retries are paced by the backoff below
+    startAttempt();
+}
+
+void wifi_mgr_start() {
+    if (_state != WIFI_MGR_OFF) return;
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);
+    startAttempt();
+}
+
+void wifi_mgr_stop() {
+    if (_state == WIFI_MGR_OFF) return;
+    setState(WIFI_MGR_OFF);          // set first so the DISCONNECTED event is not counted as a drop
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    _stats.backoff_ms = WIFI_BACKOFF_MIN_MS;
+}
+
+void wifi_mgr_set_listen_interval(uint8_t beacons) { _listenInterval = beacons; }
+
+void wifi_mgr_tick() {
+    unsigned long ms = millis();
+
+    if (_evGotIp && _state == WIFI_MGR_OFF) _evGotIp = false;   // stale event from before wifi_mgr_stop()
+    if (_evGotIp) {
+        _evGotIp = false;
+        _stats.connects++;
+        _stats.backoff_ms = WIFI_BACKOFF_MIN_MS;
+        _linkUpPending    = true;
+        _lastRssi         = ms;
+        setState(WIFI_MGR_CONNECTED);
+        recordRssi();
+    }
+    if (_evDisconnected) {
+        _evDisconnected   = false;
+        _stats.lastReason = _evReason;
+        if (_state == WIFI_MGR_CONNECTED) {
+            _stats.disconnects++;
+            enterBackoff(false);
+        } else if (_state == WIFI_MGR_CONNECTING) {
+            enterBackoff(true);
+        }
+    }
+
+    switch (_state) {
+    case WIFI_MGR_CONNECTING:
+        if (ms - _stateSince >= WIFI_CONNECT_TIMEOUT_MS) {
+            WiFi.disconnect();   // the late DISCONNECTED event is ignored while backing off
+            enterBackoff(true);
+        }
+        break;
+    case WIFI_MGR_BACKOFF:
+        if (ms - _stateSince >= _stats.backoff_ms) {
+            _stats.backoff_ms = min(_stats.backoff_ms * 2, (uint32_t)WIFI_BACKOFF_MAX_MS);
+            startAttempt();
+        }
+        break;
+    case WIFI_MGR_CONNECTED:
+        if (ms - _lastRssi >= WIFI_RSSI_PERIOD_MS) {
+            _lastRssi = ms;
+            recordRssi();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+WifiState wifi_mgr_state() { return _state; }
+
+bool wifi_mgr_connected() { return _state == WIFI_MGR_CONNECTED; }
+
+bool wifi_mgr_stable() {
+    return _state == WIFI_MGR_CONNECTED
+        && millis() - _stateSince >= WIFI_STABLE_MS
+        && WiFi.RSSI() >= WIFI_RSSI_FLOOR;
+}
+
+bool wifi_mgr_take_link_up() {
+    if (!_linkUpPending) return false;
+    _linkUpPending = false;
+    return true;
+}
+
+const WifiStats& wifi_mgr_stats() { return _stats; }
+
+void wifi_mgr_report() {
+    int sum = 0;
+    int lo  = 0;
+    int hi  = -127;
+    for (int i = 0; i < _stats.rssiCount; i++) {
+        sum += _stats.rssi[i];
+        lo   = min(lo, (int)_stats.rssi[i]);
+        hi   = max(hi, (int)_stats.rssi[i]);
+    }
+    Serial.printf("WiFi: state %d | connects %lu | drops %lu | failed %lu | RSSI avg %d min %d max %d (%u samples)\n",
+                  _state, (unsigned long)_stats.connects, (unsigned long)_stats.disconnects,
+                  (unsigned long)_stats.failedAttempts,
+                  _stats.rssiCount ? sum / _stats.rssiCount : 0, _stats.rssiCount ? lo : 0,
+                  _stats.rssiCount ? hi : 0, _stats.rssiCount);
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+
+// ─── Settings ───────────────────────────────────────────────
+#define WIFI_CONNECT_TIMEOUT_MS  15000
+#define WIFI_BACKOFF_MIN_MS      1000
+#define WIFI_BACKOFF_MAX_MS      300000UL    // 5 min
+#define WIFI_STABLE_MS           3000        // link must be up this long before jobs run
+#define WIFI_RSSI_FLOOR          -90         // dBm, below this the link is not "stable"
+#define WIFI_RSSI_HISTORY        32
+#define WIFI_RSSI_PERIOD_MS      60000
+
+enum WifiState {
+    WIFI_MGR_OFF        = 0,
+    WIFI_MGR_CONNECTING = 1,
+    WIFI_MGR_CONNECTED  = 2,
+    WIFI_MGR_BACKOFF    = 3
+};
+
+struct WifiStats {
+    uint32_t connects;              // successful associations incl. the first
+    uint32_t disconnects;
+    uint32_t failedAttempts;        // attempts that timed out or were rejected
+    uint8_t  lastReason;            // wifi_err_reason_t of the last disconnect
+    uint32_t backoff_ms;            // current retry delay
+    int8_t   rssi[WIFI_RSSI_HISTORY];   // ring buffer, one sample per WIFI_RSSI_PERIOD_MS
+    uint8_t  rssiHead;
+    uint8_t  rssiCount;
+};
+
+// ─── Public API ─────────────────────────────────────────────
+void             wifi_mgr_begin(const char* ssid, const char* password);
+void             wifi_mgr_start();               // power the radio back up and connect
+void             wifi_mgr_stop();                // drop the link and switch the radio off
+void             wifi_mgr_set_listen_interval(uint8_t beacons);   // applied at the next association
+void             wifi_mgr_tick();                // call every loop()
+WifiState        wifi_mgr_state();
+bool             wifi_mgr_connected();
+bool             wifi_mgr_stable();              // connected long enough and strong enough for network jobs
+bool             wifi_mgr_take_link_up();        // true once per (re)connection
+const WifiStats& wifi_mgr_stats();
+void             wifi_mgr_report();
@@ -1,17 +1,25 @@
 #pragma once
 #include <FastLED.h>
+#include "led_matrix.h"
 
 // ─── Hardware ───────────────────────────────────────────────
 #define LED_PIN        2
-#define NUM_LEDS       169
+#define MATRIX_ROWS    13
+#define MATRIX_COLS    13
+#define NUM_LEDS       (MATRIX_ROWS * MATRIX_COLS)
 #define LED_TYPE       WS2812B
 #define COLOR_ORDER    GRB
 #define BRIGHTNESS_MAX 255
 
 extern CRGB leds[NUM_LEDS];
 
+// Strip wiring: starts bottom left seen from the front, rows alternate
+// direction. Change this line for another panel, the rest follows.
+using WordMatrix = LedMatrix<MATRIX_ROWS, MATRIX_COLS, MATRIX_BOTTOM_LEFT, MATRIX_ROWS_SERPENTINE>;
+
 // ─── Word Colors (change freely) ────────────────────────────
 #define COLOR_TIME      CRGB(0x388940)   // warm white-gold
+#define COLOR_TIME_NIGHT CRGB(0x301808)  // dim amber, sunset to sunrise
 #define COLOR_MORNING   CRGB(0xFFDC32)   // yellow
 #define COLOR_AFTERNOON CRGB(0xFF8C00)   // orange
 #define COLOR_EVENING   CRGB(0x9650FF)   // purple
@@ -19,10 +27,16 @@ extern CRGB leds[NUM_LEDS];
 #define COLOR_AM        CRGB(0xC8C8FF)
 #define COLOR_PM        CRGB(0xFFB464)
 
+// ─── Greeting schedule (minutes, relative to local sunset) ──
+#define GREETING_EVENING_LEAD_MIN  90    // "evening" starts this long before sunset
+#define GREETING_NIGHT_LAG_MIN     180   // "night" starts this long after sunset
+#define GREETING_NIGHT_END_MIN     120   // and runs until 02:00
+
 
 // ─── Public API ─────────────────────────────────────────────
 void wordclock_init();
 void wordclock_update(int hour24, int minute);  // call every minute
 void wordclock_tick();                          // call every loop()
 void wordclock_forceUpdate();
+void wordclock_set_sun(int sunriseMinute, int sunsetMinute);   // local minutes since midnight, -1 = fixed hours
 
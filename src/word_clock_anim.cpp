@@ -1,26 +1,57 @@
 #include "word_clock_anim.h"
+#include "word_clock.h"
+#include "led_output.h"
+#include <esp_random.h>
 
-#define ROWS     13
-#define COLS     13
-#define NUM_LEDS 169
-
-extern CRGB leds[NUM_LEDS];
+#define ROWS     MATRIX_ROWS
+#define COLS     MATRIX_COLS
 
 float         animationSpeed   = 1.0f;
 AnimationType currentAnimation = ANIM_FADE;
+uint32_t      animationSeed    = ANIM_RNG_SEED;
+bool          animationEnabled = true;
 
 static CRGB oldState[NUM_LEDS];
 static CRGB newState[NUM_LEDS];
 
+static uint32_t _rng         = 1;      // xorshift32 state, never 0
+static uint32_t _lastSeed    = 0;
+static uint32_t _transitions = 0;
+
 // ─── Helpers ─────────────────────────────────────────────────
-static int idx(int row, int col) {
-    int physRow = 12 - row;
-    if (physRow % 2 == 0) return physRow * 13 + col;
-    else                  return physRow * 13 + (12 - col);
+static inline int idx(int row, int col) { return WordMatrix::at(row, col); }
+
+// Seed for transition n: a fixed base mixed with n, so every transition gets
+// its own stream but a run repeats exactly. Base 0 = hardware RNG.
+static uint32_t seedFor(uint32_t base, uint32_t n) {
+    if (!base) return esp_random();
+    uint32_t z = base + n * 0x9E3779B9u;
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    return z ^ (z >> 16);
+}
+
+static void rngSeed(uint32_t seed) {
+    _lastSeed = seed;
+    _rng = seed ? seed : 0x6D2B79F5u;
+}
+
+static uint32_t rngNext() {
+    uint32_t x = _rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return _rng = x;
 }
 
+// Same ranges as FastLED's random8()/random16(), from the high bits.
+static uint8_t  rng8()                       { return rngNext() >> 24; }
+static uint8_t  rng8(uint8_t lim)            { return (uint8_t)((rng8() * lim) >> 8); }
+static uint8_t  rng8(uint8_t lo, uint8_t hi) { return lo + rng8(hi - lo); }
+static uint16_t rng16(uint16_t lim)          { return (uint16_t)(((rngNext() >> 16) * lim) >> 16); }
+
 static void showDelay(int ms) {
-    FastLED.show();
+    led_show();
     delay((int)(ms / animationSpeed));
 }
 
@@ -135,8 +166,8 @@ static void anim_gravity() {
 static void anim_glitch() {
     for (int g = 0; g < 12; g++) {
         for (int i = 0; i < NUM_LEDS; i++) {
-            if (random8() < 80)
-                leds[i] = CRGB(random8(), random8(), random8());
+            if (rng8() < 80)
+                leds[i] = CRGB(rng8(), rng8(), rng8());
             else
                 leds[i] = CRGB::Black;
         }
@@ -151,8 +182,8 @@ static void anim_glitch() {
 //  7. RIPPLE
 // ════════════════════════════════════════════════════════════
 static void anim_ripple() {
-    int cx = 6, cy = 6;
-    int maxDist = 12;
+    int cx = COLS / 2, cy = ROWS / 2;
+    int maxDist = cx + cy;
     for (int d = 0; d <= maxDist; d++) {
         for (int row = 0; row < ROWS; row++) {
             for (int col = 0; col < COLS; col++) {
@@ -177,7 +208,7 @@ static void anim_ripple() {
 //  8. CLOCK WIPE
 // ════════════════════════════════════════════════════════════
 static void anim_clockWipe() {
-    int cx = 6, cy = 6;
+    int cx = COLS / 2, cy = ROWS / 2;
     int steps = 36;
     for (int s = 0; s < steps; s++) {
         for (int row = 0; row < ROWS; row++) {
@@ -208,32 +239,33 @@ static void anim_clockWipe() {
 // ════════════════════════════════════════════════════════════
 //  9. SPARKLE
 // ════════════════════════════════════════════════════════════
+static void shuffle(WordMatrix::Index* order, int n) {
+    for (int i = n - 1; i > 0; i--) {
+        int j = rng16(i + 1);
+        WordMatrix::Index t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+}
+
+// Every LED is visited once per pass in shuffled order, so each batch costs
+// exactly its size, however few pixels are left.
 static void anim_sparkle() {
-    bool cleared[NUM_LEDS] = {false};
-    int remaining = NUM_LEDS;
-    while (remaining > 0) {
-        int n = random8(5, 15);
-        for (int i = 0; i < n && remaining > 0; i++) {
-            int pick = random16(NUM_LEDS);
-            if (!cleared[pick]) {
-                cleared[pick] = true;
-                leds[pick] = CRGB::Black;
-                remaining--;
-            }
-        }
+    static WordMatrix::Index order[NUM_LEDS];
+    for (int i = 0; i < NUM_LEDS; i++) order[i] = i;
+    shuffle(order, NUM_LEDS);
+    for (int done = 0; done < NUM_LEDS; ) {
+        int n = rng8(5, 15);
+        for (int i = 0; i < n && done < NUM_LEDS; i++)
+            leds[order[done++]] = CRGB::Black;
         showDelay(20);
     }
-    bool revealed[NUM_LEDS] = {false};
-    remaining = NUM_LEDS;
-    while (remaining > 0) {
-        int n = random8(5, 15);
-        for (int i = 0; i < n && remaining > 0; i++) {
-            int pick = random16(NUM_LEDS);
-            if (!revealed[pick]) {
-                revealed[pick] = true;
-                leds[pick] = newState[pick];
-                remaining--;
-            }
+    shuffle(order, NUM_LEDS);
+    for (int done = 0; done < NUM_LEDS; ) {
+        int n = rng8(5, 15);
+        for (int i = 0; i < n && done < NUM_LEDS; i++) {
+            int pick = order[done++];
+            leds[pick] = newState[pick];
         }
         showDelay(20);
     }
@@ -283,6 +315,7 @@ static void anim_typewriter() {
 // ════════════════════════════════════════════════════════════
 static void anim_fire() {
     static byte heat[ROWS][COLS];
+    memset(heat, 0, sizeof(heat));       // no carry-over, the seed alone decides the frames
     for (int col = 0; col < COLS; col++) heat[ROWS-1][col] = 255;
     for (int frame = 0; frame < 40; frame++) {
         for (int row = 0; row < ROWS - 1; row++) {
@@ -290,11 +323,11 @@ static void anim_fire() {
                 int avg = (heat[row+1][col] +
                            heat[row+1][(col + COLS - 1) % COLS] +
                            heat[row+1][(col + 1) % COLS]) / 3;
-                heat[row][col] = (avg > 10) ? avg - random8(8) : 0;
+                heat[row][col] = (avg > 10) ? avg - rng8(8) : 0;
             }
         }
         for (int col = 0; col < COLS; col++)
-            heat[ROWS-1][col] = qadd8(heat[ROWS-1][col], random8(50, 100));
+            heat[ROWS-1][col] = qadd8(heat[ROWS-1][col], rng8(50, 100));
         for (int row = 0; row < ROWS; row++) {
             for (int col = 0; col < COLS; col++) {
                 byte h = heat[row][col];
@@ -326,9 +359,9 @@ static void anim_starfield() {
     for (int frame = 0; frame < 30; frame++) {
         FastLED.clear();
         for (int s = 0; s < 20; s++) {
-            int row = random8(ROWS);
-            int col = random8(COLS);
-            byte brightness = random8(100, 255);
+            int row = rng8(ROWS);
+            int col = rng8(COLS);
+            byte brightness = rng8(100, 255);
             leds[idx(row, col)] = CRGB(brightness, brightness, brightness);
         }
         showDelay(30);
@@ -336,7 +369,7 @@ static void anim_starfield() {
     FastLED.clear();
     showDelay(50);
     memcpy(leds, newState, sizeof(CRGB) * NUM_LEDS);
-    FastLED.show();
+    led_show();
 }
 
 // ════════════════════════════════════════════════════════════
@@ -347,8 +380,8 @@ static void anim_pixelShuffle() {
     memcpy(working, oldState, sizeof(CRGB) * NUM_LEDS);
     for (int frame = 0; frame < 25; frame++) {
         for (int i = 0; i < 30; i++) {
-            int a = random16(NUM_LEDS);
-            int b = random16(NUM_LEDS);
+            int a = rng16(NUM_LEDS);
+            int b = rng16(NUM_LEDS);
             CRGB tmp  = working[a];
             working[a] = working[b];
             working[b] = tmp;
@@ -404,31 +437,36 @@ static void anim_bounce() {
     }
 
     memcpy(leds, newState, sizeof(CRGB) * NUM_LEDS);
-    FastLED.show();
+    led_show();
 }
 
 // ════════════════════════════════════════════════════════════
 //  DISPATCHER
 // ════════════════════════════════════════════════════════════
 void anim_play() {
-    switch (currentAnimation) {
-        case ANIM_FADE:          anim_fade();         break;
-        case ANIM_WIPE_LR:       anim_wipeLR();       break;
-        case ANIM_WIPE_RL:       anim_wipeRL();       break;
-        case ANIM_RAIN:          anim_rain();         break;
-        case ANIM_GRAVITY:       anim_gravity();      break;
-        case ANIM_GLITCH:        anim_glitch();       break;
-        case ANIM_RIPPLE:        anim_ripple();       break;
-        case ANIM_CLOCK_WIPE:    anim_clockWipe();    break;
-        case ANIM_SPARKLE:       anim_sparkle();      break;
-        case ANIM_HEARTBEAT:     anim_heartbeat();    break;
-        case ANIM_TYPEWRITER:    anim_typewriter();   break;
-        case ANIM_FIRE:          anim_fire();         break;
-        case ANIM_STARFIELD:     anim_starfield();    break;
-        case ANIM_PIXEL_SHUFFLE: anim_pixelShuffle(); break;
-        case ANIM_BOUNCE:        anim_bounce();       break;
-        default:                 anim_fade();         break;
+    rngSeed(seedFor(animationSeed, _transitions++));
+    if (animationEnabled) {
+        switch (currentAnimation) {
+            case ANIM_FADE:          anim_fade();         break;
+            case ANIM_WIPE_LR:       anim_wipeLR();       break;
+            case ANIM_WIPE_RL:       anim_wipeRL();       break;
+            case ANIM_RAIN:          anim_rain();         break;
+            case ANIM_GRAVITY:       anim_gravity();      break;
+            case ANIM_GLITCH:        anim_glitch();       break;
+            case ANIM_RIPPLE:        anim_ripple();       break;
+            case ANIM_CLOCK_WIPE:    anim_clockWipe();    break;
+            case ANIM_SPARKLE:       anim_sparkle();      break;
+            case ANIM_HEARTBEAT:     anim_heartbeat();    break;
+            case ANIM_TYPEWRITER:    anim_typewriter();   break;
+            case ANIM_FIRE:          anim_fire();         break;
+            case ANIM_STARFIELD:     anim_starfield();    break;
+            case ANIM_PIXEL_SHUFFLE: anim_pixelShuffle(); break;
+            case ANIM_BOUNCE:        anim_bounce();       break;
+            default:                 anim_fade();         break;
+        }
     }
     memcpy(leds, newState, sizeof(CRGB) * NUM_LEDS);
-    FastLED.show();
+    led_show();
 }
+
+uint32_t anim_last_seed() { return _lastSeed; }
@@ -1,6 +1,14 @@
 #pragma once
 #include <FastLED.h>
 
+// Random animations draw from their own xorshift32 stream, reseeded at the
+// start of every anim_play(). A non-zero animationSeed derives each
+// transition's seed from it and the transition count, so a run repeats frame
+// for frame; 0 takes a fresh hardware random seed per transition.
+#ifndef ANIM_RNG_SEED
+#define ANIM_RNG_SEED  0
+#endif
+
 enum AnimationType {
     ANIM_FADE         = 0,
     ANIM_WIPE_LR      = 1,
@@ -23,7 +31,10 @@ enum AnimationType {
 // Set from Blynk later
 extern float         animationSpeed;
 extern AnimationType currentAnimation;
+extern uint32_t      animationSeed;
+extern bool          animationEnabled;   // false = anim_play() shows the new state at once
 
 void anim_snapshotOld();   // call BEFORE wordclock_update()
 void anim_snapshotNew();   // call AFTER wordclock_update() computes new state
 void anim_play();          // plays transition then sets leds[] to new state
+uint32_t anim_last_seed(); // seed used by the last anim_play()
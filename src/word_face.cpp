@@ -0,0 +1,161 @@
+#include "word_face.h"
+#include "word_face_layout.h"
+
+// ─── Helpers ─────────────────────────────────────────────────
+// Everything up to the public section is constexpr: the runtime lookup and
+// the compile-time checks below go through the same code.
+constexpr bool isContinuation(char c) { return ((uint8_t)c & 0xC0) == 0x80; }
+constexpr bool takesCell(char c)      { return !isContinuation(c) && c != '\''; }
+
+constexpr int glyphCount(const char* s) {
+    int n = 0;
+    for (; *s; s++)
+        if (takesCell(*s)) n++;
+    return n;
+}
+
+// Code point in cell n of s, 0 past the end.
+constexpr uint32_t glyphAt(const char* s, int n) {
+    for (; *s; s++) {
+        if (!takesCell(*s) || n-- > 0) continue;
+        uint8_t  c     = (uint8_t)*s;
+        int      extra = c < 0x80 ? 0 : c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : 1;
+        uint32_t cp    = extra ? c & (0x3F >> extra) : c;
+        for (int i = 1; i <= extra; i++) cp = (cp << 6) | ((uint8_t)s[i] & 0x3F);
+        return cp;
+    }
+    return 0;
+}
+
+constexpr const FaceRule& ruleFor(const Face& f, int minute) {
+    int i = 0;
+    while (i < f.ruleCount - 1 && minute > f.rules[i].lastMinute) i++;
+    return f.rules[i];
+}
+
+constexpr uint64_t timeWords(const Face& f, int hour24, int minute) {
+    const FaceRule& r     = ruleFor(f, minute);
+    int             shown = (hour24 + r.hourOffset) % 24;
+    const uint8_t*  hours = r.fullHour && f.fullHours ? f.fullHours : f.hours;
+    uint64_t        w     = f.always | r.words | (1ULL << hours[shown % 12]);
+    if (f.am != FACE_NONE) w |= 1ULL << (shown < 12 ? f.am : f.pm);
+    return w;
+}
+
+// ─── Layout checks ───────────────────────────────────────────
+constexpr bool validWord(const Face& f, uint8_t w) { return w < f.wordCount && w < 64; }
+
+constexpr bool wordsFit(const Face& f) {
+    for (int i = 0; i < f.wordCount; i++) {
+        int len = glyphCount(f.words[i].text);
+        if (len == 0 || f.words[i].row >= FACE_ROWS || f.words[i].col + len > FACE_COLS) return false;
+    }
+    return true;
+}
+
+constexpr bool gridMatches(const Face& f) {
+    if (!f.grid) return true;
+    for (int r = 0; r < FACE_ROWS; r++)
+        if (glyphCount(f.grid[r]) != FACE_COLS) return false;
+    for (int i = 0; i < f.wordCount; i++) {
+        const FaceWord& w = f.words[i];
+        for (int k = 0; k < glyphCount(w.text); k++)
+            if (glyphAt(w.text, k) != glyphAt(f.grid[w.row], w.col + k)) return false;
+    }
+    return true;
+}
+
+constexpr bool tablesValid(const Face& f) {
+    if (f.ruleCount == 0 || f.rules[f.ruleCount - 1].lastMinute != 59) return false;
+    for (int i = 0; i < f.ruleCount; i++) {
+        if (i && f.rules[i].lastMinute <= f.rules[i - 1].lastMinute) return false;
+        if (f.rules[i].words >> f.wordCount) return false;
+    }
+    if (f.always >> f.wordCount) return false;
+    for (int h = 0; h < 12; h++) {
+        if (!validWord(f, f.hours[h])) return false;
+        if (f.fullHours && !validWord(f, f.fullHours[h])) return false;
+    }
+    if ((f.am == FACE_NONE) != (f.pm == FACE_NONE)) return false;
+    if (f.am != FACE_NONE && (!validWord(f, f.am) || !validWord(f, f.pm))) return false;
+    for (int g = 0; g < 4; g++)
+        if (f.greetings[g] != FACE_NONE && !validWord(f, f.greetings[g])) return false;
+    return true;
+}
+
+// Every minute of the day: no two lit words share a cell, and the phrase
+// fits in FACE_MAX_SPANS.
+constexpr bool phrasesFit(const Face& f) {
+    for (int m = 0; m < 24 * 60; m++) {
+        uint64_t w = timeWords(f, m / 60, m % 60);
+        uint16_t used[FACE_ROWS] = {};
+        int      spans = 0;
+        for (int i = 0; i < f.wordCount; i++) {
+            if (!(w >> i & 1)) continue;
+            const FaceWord& fw   = f.words[i];
+            uint16_t        bits = (uint16_t)(((1u << glyphCount(fw.text)) - 1) << fw.col);
+            if (used[fw.row] & bits) return false;
+            used[fw.row] |= bits;
+            spans++;
+        }
+        if (spans > FACE_MAX_SPANS) return false;
+    }
+    return true;
+}
+
+#define CHECK_FACE(i)                                                             \
+    static_assert(wordsFit(faces[i]),    "face " #i ": word outside the grid");    \
+    static_assert(gridMatches(faces[i]), "face " #i ": word misspelt on the grid"); \
+    static_assert(tablesValid(faces[i]), "face " #i ": bad rule or word table");    \
+    static_assert(phrasesFit(faces[i]),  "face " #i ": overlapping words in a phrase")
+
+CHECK_FACE(FACE_EN_ALMOST);
+CHECK_FACE(FACE_EN_FIVE);
+CHECK_FACE(FACE_DE);
+static_assert(WORDCLOCK_FACE >= 0 && WORDCLOCK_FACE < FACE_COUNT, "unknown WORDCLOCK_FACE");
+
+// Spans of the selected face, so the lookup never touches the strings.
+struct SpanTable {
+    uint8_t row[64];
+    uint8_t col[64];
+    uint8_t len[64];
+};
+
+constexpr SpanTable makeSpans(const Face& f) {
+    SpanTable t = {};
+    for (int i = 0; i < f.wordCount; i++) {
+        t.row[i] = f.words[i].row;
+        t.col[i] = f.words[i].col;
+        t.len[i] = (uint8_t)glyphCount(f.words[i].text);
+    }
+    return t;
+}
+
+static constexpr const Face& _face  = faces[WORDCLOCK_FACE];
+static constexpr SpanTable   _spans = makeSpans(_face);
+
+static FaceSpan spanOf(uint8_t w, uint8_t color) {
+    return FaceSpan{ _spans.row[w], _spans.col[w], _spans.len[w], color };
+}
+
+// ─── Public ─────────────────────────────────────────────────
+int face_time_spans(int hour24, int minute, FaceSpan* out) {
+    uint64_t w = timeWords(_face, hour24 % 24, minute % 60);
+    int      n = 0;
+    for (uint8_t i = 0; w; i++, w >>= 1) {
+        if (!(w & 1)) continue;
+        uint8_t color = FACE_COLOR_TIME;
+        if (i == _face.am)      color = FACE_COLOR_AM;
+        else if (i == _face.pm) color = FACE_COLOR_PM;
+        out[n++] = spanOf(i, color);
+    }
+    return n;
+}
+
+bool face_greeting_span(int category, FaceSpan* out) {
+    if (category < 0 || category >= 4 || _face.greetings[category] == FACE_NONE) return false;
+    *out = spanOf(_face.greetings[category], FACE_COLOR_TIME);
+    return true;
+}
+
+const char* face_name() { return _face.name; }
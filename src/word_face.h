@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+
+// ─── Word clock faces ───────────────────────────────────────
+// The letter grid, word positions and phrase rules of each faceplate are data
+// (word_face_layout.h), checked for every minute of the day at compile time.
+// The face is chosen at build time; the phrase lookup is a short table scan
+// and a walk over a word bitmask.
+#define FACE_EN_ALMOST   0     // "IT IS ALMOST TEN MINUTES PAST", the original plate
+#define FACE_EN_FIVE     1     // same plate, plain five-minute steps
+#define FACE_DE          2     // German plate, "ES IST FÜNF VOR HALB DREI"
+#define FACE_COUNT       3
+
+#ifndef WORDCLOCK_FACE
+#define WORDCLOCK_FACE   FACE_EN_ALMOST
+#endif
+
+#define FACE_ROWS        13
+#define FACE_COLS        13
+#define FACE_MAX_SPANS   12    // most words one phrase can light
+
+enum FaceColor : uint8_t {
+    FACE_COLOR_TIME = 0,
+    FACE_COLOR_AM   = 1,
+    FACE_COLOR_PM   = 2
+};
+
+struct FaceSpan {
+    uint8_t row;
+    uint8_t col;
+    uint8_t len;
+    uint8_t color;        // FaceColor
+};
+
+// ─── Public API ─────────────────────────────────────────────
+int         face_time_spans(int hour24, int minute, FaceSpan* out);   // fills ≤ FACE_MAX_SPANS, returns count
+bool        face_greeting_span(int category, FaceSpan* out);         // 0 morning … 3 night, false = not on this plate
+const char* face_name();
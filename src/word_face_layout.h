@@ -0,0 +1,192 @@
+#pragma once
+#include "word_face.h"
+
+// ─── Face layouts ───────────────────────────────────────────
+// A word is spelled as printed on the plate, at the row and column of its
+// first letter; its length is the letter count (UTF-8 aware, an apostrophe
+// shares the cell of the letter before it). Rules are ordered by the last
+// minute they cover and name the words lit besides the always-on ones, the
+// hour word and AM/PM. When a plate's letters are recorded in grid, every
+// word must spell out the letters under it.
+#define FACE_NONE  0xFF
+
+struct FaceWord {
+    const char* text;
+    uint8_t     row;
+    uint8_t     col;
+};
+
+struct FaceRule {
+    uint8_t  lastMinute;      // applies up to and including this minute
+    int8_t   hourOffset;      // 1 = name the coming hour ("TEN TO SIX")
+    bool     fullHour;        // take the hour from fullHours ("EIN UHR")
+    uint64_t words;
+};
+
+struct Face {
+    const char*     name;
+    const char* const* grid;              // FACE_ROWS rows, nullptr = letters not recorded
+    const FaceWord* words;
+    uint8_t         wordCount;
+    uint64_t        always;               // lit in every phrase
+    const FaceRule* rules;
+    uint8_t         ruleCount;
+    const uint8_t*  hours;                // 12 words, index hour % 12
+    const uint8_t*  fullHours;            // nullptr = same as hours
+    uint8_t         am;                   // FACE_NONE = no AM/PM on the plate
+    uint8_t         pm;
+    uint8_t         greetings[4];         // morning, afternoon, evening, night
+};
+
+constexpr uint64_t face_words() { return 0; }
+
+template <typename... T>
+constexpr uint64_t face_words(uint8_t w, T... rest) { return (1ULL << w) | face_words(rest...); }
+
+// ─── English ────────────────────────────────────────────────
+namespace face_en {
+
+enum : uint8_t {
+    IT, IS, ALMOST, A, QUARTER, TEN, TWENTY, FIVE, HALF, MINUTES, PAST, TO, OCLOCK,
+    H1, H2, H3, H4, H5, H6, H7, H8, H9, H10, H11, H12,
+    AM, PM, MORNING, AFTERNOON, EVENING, NIGHT,
+    COUNT
+};
+
+constexpr FaceWord words[COUNT] = {
+    { "IT",            0,  0 }, { "IS",        0,  3 }, { "ALMOST",    0,  6 },
+    { "A",             1,  0 }, { "QUARTER",   1,  2 }, { "TEN",       1, 10 },
+    { "TWENTY",        2,  0 }, { "FIVE",      2,  6 }, { "HALF",      3,  0 },
+    { "MINUTES",       3,  5 }, { "PAST",      4,  0 }, { "TO",        4,  6 },
+    { "O'CLOCK",       9,  2 },
+    { "ONE",           4,  9 }, { "TWO",       5,  0 }, { "THREE",     5,  3 },
+    { "FOUR",          5,  8 }, { "FIVE",      6,  0 }, { "SIX",       6,  5 },
+    { "SEVEN",         6,  8 }, { "EIGHT",     7,  0 }, { "NINE",      7,  5 },
+    { "TEN",           7,  9 }, { "ELEVEN",    8,  0 }, { "TWELVE",    8,  7 },
+    { "AM",            9,  9 }, { "PM",        9, 11 },
+    { "GOOD MORNING", 10,  0 }, { "AFTERNOON", 11,  0 },
+    { "EVENING",      12,  0 }, { "NIGHT",    12,  8 },
+};
+
+constexpr uint8_t hours[12] = { H12, H1, H2, H3, H4, H5, H6, H7, H8, H9, H10, H11 };
+
+// Rounds to the nearest five minutes and says ALMOST while short of it.
+constexpr FaceRule almostRules[] = {
+    {  2, 0, false, face_words(OCLOCK) },
+    {  4, 0, false, face_words(ALMOST, FIVE, MINUTES, PAST) },
+    {  7, 0, false, face_words(FIVE, MINUTES, PAST) },
+    {  9, 0, false, face_words(ALMOST, TEN, MINUTES, PAST) },
+    { 12, 0, false, face_words(TEN, MINUTES, PAST) },
+    { 14, 0, false, face_words(ALMOST, A, QUARTER, PAST) },
+    { 17, 0, false, face_words(A, QUARTER, PAST) },
+    { 19, 0, false, face_words(ALMOST, TWENTY, MINUTES, PAST) },
+    { 22, 0, false, face_words(TWENTY, MINUTES, PAST) },
+    { 24, 0, false, face_words(ALMOST, TWENTY, FIVE, MINUTES, PAST) },
+    { 27, 0, false, face_words(TWENTY, FIVE, MINUTES, PAST) },
+    { 29, 0, false, face_words(ALMOST, HALF, PAST) },
+    { 32, 0, false, face_words(HALF, PAST) },
+    { 34, 1, false, face_words(ALMOST, TWENTY, FIVE, MINUTES, TO) },
+    { 37, 1, false, face_words(TWENTY, FIVE, MINUTES, TO) },
+    { 39, 1, false, face_words(ALMOST, TWENTY, MINUTES, TO) },
+    { 42, 1, false, face_words(TWENTY, MINUTES, TO) },
+    { 44, 1, false, face_words(ALMOST, A, QUARTER, TO) },
+    { 47, 1, false, face_words(A, QUARTER, TO) },
+    { 49, 1, false, face_words(ALMOST, TEN, MINUTES, TO) },
+    { 52, 1, false, face_words(TEN, MINUTES, TO) },
+    { 54, 1, false, face_words(ALMOST, FIVE, MINUTES, TO) },
+    { 57, 1, false, face_words(FIVE, MINUTES, TO) },
+    { 59, 1, false, face_words(ALMOST, OCLOCK) },
+};
+
+// Shows the last five-minute step that has passed.
+constexpr FaceRule fiveRules[] = {
+    {  4, 0, false, face_words(OCLOCK) },
+    {  9, 0, false, face_words(FIVE, MINUTES, PAST) },
+    { 14, 0, false, face_words(TEN, MINUTES, PAST) },
+    { 19, 0, false, face_words(A, QUARTER, PAST) },
+    { 24, 0, false, face_words(TWENTY, MINUTES, PAST) },
+    { 29, 0, false, face_words(TWENTY, FIVE, MINUTES, PAST) },
+    { 34, 0, false, face_words(HALF, PAST) },
+    { 39, 1, false, face_words(TWENTY, FIVE, MINUTES, TO) },
+    { 44, 1, false, face_words(TWENTY, MINUTES, TO) },
+    { 49, 1, false, face_words(A, QUARTER, TO) },
+    { 54, 1, false, face_words(TEN, MINUTES, TO) },
+    { 59, 1, false, face_words(FIVE, MINUTES, TO) },
+};
+
+} // namespace face_en
+
+// ─── German ─────────────────────────────────────────────────
+namespace face_de {
+
+enum : uint8_t {
+    ES, IST, FUENF, ZEHN, ZWANZIG, VIERTEL, VOR, NACH, HALB, UHR,
+    EIN, H1, H2, H3, H4, H5, H6, H7, H8, H9, H10, H11, H12,
+    MORGEN, TAG, ABEND, NACHT,
+    COUNT
+};
+
+constexpr FaceWord words[COUNT] = {
+    { "ES",          0,  0 }, { "IST",      0,  3 }, { "FÜNF",     0,  7 },
+    { "ZEHN",        1,  0 }, { "ZWANZIG",  1,  4 }, { "VIERTEL",  2,  4 },
+    { "VOR",         3,  0 }, { "NACH",     3,  7 }, { "HALB",     4,  0 },
+    { "UHR",         9,  9 },
+    { "EIN",         5,  0 }, { "EINS",     5,  0 }, { "ZWEI",     5,  7 },
+    { "DREI",        6,  0 }, { "VIER",     6,  7 }, { "FÜNF",     4,  8 },
+    { "SECHS",       7,  0 }, { "SIEBEN",   8,  0 }, { "ACHT",     7,  7 },
+    { "NEUN",        9,  5 }, { "ZEHN",     9,  0 }, { "ELF",      4,  5 },
+    { "ZWÖLF",       8,  6 },
+    { "GUTENMORGEN",10,  0 }, { "GUTENTAG",11,  0 },
+    { "ABEND",      12,  0 }, { "NACHT",   12,  8 },
+};
+
+constexpr const char* grid[FACE_ROWS] = {
+    "ESKISTAFÜNFXY",
+    "ZEHNZWANZIGQP",
+    "DREIVIERTELTG",
+    "VORFUNKNACHJM",
+    "HALBXELFFÜNFO",
+    "EINSXQLZWEIQK",
+    "DREIOPJVIERUW",
+    "SECHSNLACHTRB",
+    "SIEBENZWÖLFDH",
+    "ZEHNXNEUNUHRV",
+    "GUTENMORGENXZ",
+    "GUTENTAGQRSTW",
+    "ABENDXYZNACHT",
+};
+
+constexpr uint8_t hours[12]     = { H12, H1,  H2, H3, H4, H5, H6, H7, H8, H9, H10, H11 };
+constexpr uint8_t fullHours[12] = { H12, EIN, H2, H3, H4, H5, H6, H7, H8, H9, H10, H11 };
+
+// Five-minute steps; from :25 the half hour counts towards the next hour.
+constexpr FaceRule rules[] = {
+    {  4, 0, true,  face_words(UHR) },
+    {  9, 0, false, face_words(FUENF, NACH) },
+    { 14, 0, false, face_words(ZEHN, NACH) },
+    { 19, 0, false, face_words(VIERTEL, NACH) },
+    { 24, 0, false, face_words(ZWANZIG, NACH) },
+    { 29, 1, false, face_words(FUENF, VOR, HALB) },
+    { 34, 1, false, face_words(HALB) },
+    { 39, 1, false, face_words(FUENF, NACH, HALB) },
+    { 44, 1, false, face_words(ZWANZIG, VOR) },
+    { 49, 1, false, face_words(VIERTEL, VOR) },
+    { 54, 1, false, face_words(ZEHN, VOR) },
+    { 59, 1, false, face_words(FUENF, VOR) },
+};
+
+} // namespace face_de
+
+#define FACE_RULES(r)  r, (uint8_t)(sizeof(r) / sizeof(r[0]))
+
+constexpr Face faces[FACE_COUNT] = {
+    { "en-almost", nullptr, face_en::words, face_en::COUNT, face_words(face_en::IT, face_en::IS),
+      FACE_RULES(face_en::almostRules), face_en::hours, nullptr, face_en::AM, face_en::PM,
+      { face_en::MORNING, face_en::AFTERNOON, face_en::EVENING, face_en::NIGHT } },
+    { "en-five", nullptr, face_en::words, face_en::COUNT, face_words(face_en::IT, face_en::IS),
+      FACE_RULES(face_en::fiveRules), face_en::hours, nullptr, face_en::AM, face_en::PM,
+      { face_en::MORNING, face_en::AFTERNOON, face_en::EVENING, face_en::NIGHT } },
+    { "de", face_de::grid, face_de::words, face_de::COUNT, face_words(face_de::ES, face_de::IST),
+      FACE_RULES(face_de::rules), face_de::hours, face_de::fullHours, FACE_NONE, FACE_NONE,
+      { face_de::MORGEN, face_de::TAG, face_de::ABEND, face_de::NACHT } },
+};
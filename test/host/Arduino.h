@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+
+// ─── Host stand-in for the Arduino core ─────────────────────
+// Only what the modules under test use. Serial goes to stdout unless a test
+// mutes it around a sweep that is expected to log on every call.
+using std::isnan;
+using std::min;
+using std::max;
+
+inline unsigned long millis() {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return (unsigned long)duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+struct HostSerial {
+    bool muted = false;
+
+    int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        if (muted) return 0;
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vprintf(fmt, ap);
+        va_end(ap);
+        return n;
+    }
+    void print(const char* s)        { if (!muted) fputs(s, stdout); }
+    void println(const char* s = "") { if (!muted) puts(s); }
+};
+
+inline HostSerial Serial;
@@ -0,0 +1,48 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+// ─── Host stand-in for FastLED ──────────────────────────────
+// CRGB and the controller calls the word clock makes. No LEDs are driven:
+// tests read leds[] or capture frames in their own led_show().
+struct CRGB {
+    uint8_t r, g, b;
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {}
+    CRGB(uint32_t rgb) : r(rgb >> 16), g(rgb >> 8), b(rgb) {}
+
+    bool operator==(const CRGB& o) const { return r == o.r && g == o.g && b == o.b; }
+    bool operator!=(const CRGB& o) const { return !(*this == o); }
+    explicit operator bool() const { return r || g || b; }
+};
+
+enum EOrder { RGB = 0012, GRB = 0102 };
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER> class WS2812B {};
+
+class CLEDController {
+public:
+    void show(const CRGB*, int, uint8_t) {}
+};
+
+class CFastLED {
+    CRGB*          _leds  = nullptr;
+    int            _count = 0;
+    uint8_t        _brightness = 255;
+    CLEDController _ctrl;
+
+public:
+    template <template <uint8_t, EOrder> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CLEDController& addLeds(CRGB* leds, int count) {
+        _leds  = leds;
+        _count = count;
+        return _ctrl;
+    }
+    void    setBrightness(uint8_t b) { _brightness = b; }
+    uint8_t getBrightness() const    { return _brightness; }
+    void    clear(bool = false)      { if (_leds) memset((void*)_leds, 0, sizeof(CRGB) * _count); }
+    void    show() {}
+};
+
+inline CFastLED FastLED;
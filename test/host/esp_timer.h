@@ -0,0 +1,11 @@
+#pragma once
+#include <stdint.h>
+#include <chrono>
+
+// ─── Host stand-in for esp_timer ────────────────────────────
+// Only the clock; microseconds since first use.
+inline int64_t esp_timer_get_time() {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ─── Host stand-in for LVGL ─────────────────────────────────
+// Just enough of the LVGL 9 API for the generated ui/*.h headers and the
+// modules under test to compile natively. Objects only record the flags and
+// colours set on them so a test can check what a module configured.
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _lv_obj_t {
+    uint32_t flags;
+    uint32_t bg_color;
+    uint32_t text_color;
+    int      anims;
+} lv_obj_t;
+
+typedef struct _lv_anim_t   { lv_obj_t* var; } lv_anim_t;
+typedef struct _lv_event_t  { int code; } lv_event_t;
+typedef struct _lv_font_t   { int unused; } lv_font_t;
+typedef struct _lv_image_dsc_t { const uint8_t* data; } lv_image_dsc_t;
+typedef struct { uint32_t full; } lv_color_t;
+typedef int lv_screen_load_anim_t;
+typedef uint32_t lv_style_selector_t;
+
+#define LV_IMG_DECLARE(name)    extern const lv_image_dsc_t name
+#define LV_IMAGE_DECLARE(name)  extern const lv_image_dsc_t name
+#define LV_FONT_DECLARE(name)   extern const lv_font_t name
+
+#define LV_OBJ_FLAG_HIDDEN      (1u << 0)
+
+static inline lv_color_t lv_color_hex(uint32_t c) { lv_color_t r = { c & 0xFFFFFF }; return r; }
+
+static inline void lv_obj_add_flag(lv_obj_t* o, uint32_t f)   { o->flags |= f; }
+static inline void lv_obj_clear_flag(lv_obj_t* o, uint32_t f) { o->flags &= ~f; }
+static inline void lv_obj_remove_flag(lv_obj_t* o, uint32_t f) { o->flags &= ~f; }
+static inline bool lv_obj_has_flag(const lv_obj_t* o, uint32_t f) { return (o->flags & f) == f; }
+
+static inline void lv_obj_set_style_bg_color(lv_obj_t* o, lv_color_t c, lv_style_selector_t s) {
+    (void)s; o->bg_color = c.full;
+}
+static inline void lv_obj_set_style_text_color(lv_obj_t* o, lv_color_t c, lv_style_selector_t s) {
+    (void)s; o->text_color = c.full;
+}
+static inline void lv_obj_set_style_text_font(lv_obj_t* o, const lv_font_t* f, lv_style_selector_t s) {
+    (void)o; (void)f; (void)s;
+}
+static inline void lv_label_set_text(lv_obj_t* o, const char* t) { (void)o; (void)t; }
+
+static inline bool lv_anim_del(void* var, void* cb) {
+    (void)cb;
+    lv_obj_t* o = (lv_obj_t*)var;
+    bool had = o->anims > 0;
+    o->anims = 0;
+    return had;
+}
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,176 @@
+// Native test: pio test -e native -f test_aqi
+#include <unity.h>
+#include "aqi.cpp"
+
+// ─── Reference ──────────────────────────────────────────────
+// CPCB breakpoints as published: µg/m³, CO in mg/m³. The last column is
+// where the Severe band is taken to reach 500.
+static const double cpcb[AQI_POLLUTANT_COUNT][7] = {
+    /* PM2.5 */ { 0, 30, 60,  90, 120, 250, 380 },
+    /* PM10  */ { 0, 50, 100, 250, 350, 430, 510 },
+    /* NO2   */ { 0, 40, 80,  180, 280, 400, 520 },
+    /* O3    */ { 0, 50, 100, 168, 208, 748, 1288 },
+    /* SO2   */ { 0, 40, 80,  380, 800, 1600, 2400 },
+    /* CO    */ { 0, 1.0, 2.0, 10, 17, 34, 51 },
+};
+static const int nodes[7] = { 0, 50, 100, 200, 300, 400, 500 };
+
+// Breakpoint in the 0.1 µg/m³ units aqi_sub_index() takes
+static int32_t bpConc(int p, int i) {
+    double scale = p == AQI_CO ? 10000.0 : 10.0;
+    return (int32_t)lround(cpcb[p][i] * scale);
+}
+
+// Ip = Ilo + (Ihi - Ilo) / (BPhi - BPlo) × (C - BPlo), rounded half up
+static int reference(int p, int32_t conc) {
+    if (conc < 0) return AQI_MISSING;
+    if (conc >= bpConc(p, 6)) return AQI_MAX;
+    int band = 0;
+    while (conc > bpConc(p, band + 1)) band++;
+    double lo = bpConc(p, band), hi = bpConc(p, band + 1);
+    double ip = nodes[band] + (nodes[band + 1] - nodes[band]) / (hi - lo) * (conc - lo);
+    return (int)floor(ip + 0.5);
+}
+
+static void fill(int32_t conc[AQI_POLLUTANT_COUNT], int32_t v) {
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++) conc[p] = v;
+}
+
+// ─── Tests ──────────────────────────────────────────────────
+void setUp() {}
+void tearDown() {}
+
+static void test_breakpoints_hit_their_nodes() {
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++)
+        for (int i = 0; i < 7; i++)
+            TEST_ASSERT_EQUAL_INT_MESSAGE(nodes[i], aqi_sub_index((AqiPollutant)p, bpConc(p, i)),
+                                          aqi_pollutant_name(p));
+}
+
+static void test_breakpoint_neighbours() {
+    char msg[48];
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++) {
+        for (int i = 0; i < 7; i++) {
+            for (int d = -1; d <= 1; d += 2) {
+                int32_t c = bpConc(p, i) + d;
+                if (c < 0) continue;
+                snprintf(msg, sizeof(msg), "%s at breakpoint %d %+d", aqi_pollutant_name(p), i, d);
+                int got = aqi_sub_index((AqiPollutant)p, c);
+                TEST_ASSERT_EQUAL_INT_MESSAGE(reference(p, c), got, msg);
+                // Just below a breakpoint never reaches its node, just above never falls under it
+                if (d < 0) TEST_ASSERT_TRUE_MESSAGE(got <= nodes[i], msg);
+                else       TEST_ASSERT_TRUE_MESSAGE(got >= nodes[i], msg);
+            }
+        }
+    }
+}
+
+static void test_whole_range_matches_reference() {
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++) {
+        int32_t top  = bpConc(p, 6) + 100;
+        int32_t step = top / 5000 + 1;
+        int     prev = 0;
+        for (int32_t c = 0; c <= top; c += step) {
+            int got = aqi_sub_index((AqiPollutant)p, c);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(reference(p, c), got, aqi_pollutant_name(p));
+            TEST_ASSERT_TRUE_MESSAGE(got >= prev, "sub-index must not decrease");
+            prev = got;
+        }
+    }
+}
+
+static void test_missing_and_clamped() {
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++) {
+        TEST_ASSERT_EQUAL_INT(AQI_MISSING, aqi_sub_index((AqiPollutant)p, AQI_MISSING));
+        TEST_ASSERT_EQUAL_INT(AQI_MAX, aqi_sub_index((AqiPollutant)p, bpConc(p, 6) * 4));
+    }
+}
+
+static void test_conc_conversion() {
+    TEST_ASSERT_EQUAL_INT(0,    aqi_conc(0.0f));
+    TEST_ASSERT_EQUAL_INT(301,  aqi_conc(30.1f));
+    TEST_ASSERT_EQUAL_INT(300,  aqi_conc(29.96f));
+    TEST_ASSERT_EQUAL_INT(10000, aqi_conc(1000.0f));      // 1.0 mg/m³ CO
+    TEST_ASSERT_EQUAL_INT(AQI_MISSING, aqi_conc(-0.1f));
+    TEST_ASSERT_EQUAL_INT(AQI_MISSING, aqi_conc(NAN));
+}
+
+static void test_dominant_pollutant() {
+    for (int winner = 0; winner < AQI_POLLUTANT_COUNT; winner++) {
+        int32_t conc[AQI_POLLUTANT_COUNT];
+        for (int p = 0; p < AQI_POLLUTANT_COUNT; p++) conc[p] = bpConc(p, 1);   // all 50
+        conc[winner] = bpConc(winner, 3);                                    // 200
+        AqiResult r = aqi_compute(conc);
+        TEST_ASSERT_EQUAL_INT(200, r.aqi);
+        TEST_ASSERT_EQUAL_INT(winner, r.dominant);
+        for (int p = 0; p < AQI_POLLUTANT_COUNT; p++)
+            TEST_ASSERT_EQUAL_INT(p == winner ? 200 : 50, r.sub[p]);
+    }
+
+    // A tie goes to the pollutant listed first
+    int32_t conc[AQI_POLLUTANT_COUNT];
+    fill(conc, AQI_MISSING);
+    conc[AQI_O3] = bpConc(AQI_O3, 2);
+    conc[AQI_NO2] = bpConc(AQI_NO2, 2);
+    AqiResult r = aqi_compute(conc);
+    TEST_ASSERT_EQUAL_INT(100, r.aqi);
+    TEST_ASSERT_EQUAL_INT(AQI_NO2, r.dominant);
+}
+
+static void test_valid_rule() {
+    int32_t conc[AQI_POLLUTANT_COUNT];
+
+    fill(conc, AQI_MISSING);
+    AqiResult r = aqi_compute(conc);
+    TEST_ASSERT_EQUAL_INT(AQI_MISSING, r.aqi);
+    TEST_ASSERT_FALSE(r.valid);
+
+    // Three pollutants, one of them PM2.5 or PM10
+    for (int pm = AQI_PM25; pm <= AQI_PM10; pm++) {
+        fill(conc, AQI_MISSING);
+        conc[pm] = 100; conc[AQI_NO2] = 100;
+        TEST_ASSERT_FALSE(aqi_compute(conc).valid);
+        conc[AQI_CO] = 100;
+        TEST_ASSERT_TRUE(aqi_compute(conc).valid);
+    }
+
+    // Four gases without particulates are not enough
+    fill(conc, 100);
+    conc[AQI_PM25] = conc[AQI_PM10] = AQI_MISSING;
+    r = aqi_compute(conc);
+    TEST_ASSERT_FALSE(r.valid);
+    TEST_ASSERT_TRUE(r.aqi != AQI_MISSING);
+
+    fill(conc, 0);
+    TEST_ASSERT_TRUE(aqi_compute(conc).valid);
+}
+
+static void test_category_edges() {
+    TEST_ASSERT_EQUAL_STRING("--",           aqi_category(AQI_MISSING));
+    TEST_ASSERT_EQUAL_STRING("Good",         aqi_category(0));
+    TEST_ASSERT_EQUAL_STRING("Good",         aqi_category(50));
+    TEST_ASSERT_EQUAL_STRING("Satisfactory", aqi_category(51));
+    TEST_ASSERT_EQUAL_STRING("Satisfactory", aqi_category(100));
+    TEST_ASSERT_EQUAL_STRING("Moderate",     aqi_category(101));
+    TEST_ASSERT_EQUAL_STRING("Moderate",     aqi_category(200));
+    TEST_ASSERT_EQUAL_STRING("Poor",         aqi_category(201));
+    TEST_ASSERT_EQUAL_STRING("Poor",         aqi_category(300));
+    TEST_ASSERT_EQUAL_STRING("Very Poor",    aqi_category(301));
+    TEST_ASSERT_EQUAL_STRING("Very Poor",    aqi_category(400));
+    TEST_ASSERT_EQUAL_STRING("Severe",       aqi_category(401));
+    TEST_ASSERT_EQUAL_STRING("Severe",       aqi_category(AQI_MAX));
+}
+
+int main(int argc, char** argv) {
+    (void)argc; (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_breakpoints_hit_their_nodes);
+    RUN_TEST(test_breakpoint_neighbours);
+    RUN_TEST(test_whole_range_matches_reference);
+    RUN_TEST(test_missing_and_clamped);
+    RUN_TEST(test_conc_conversion);
+    RUN_TEST(test_dominant_pollutant);
+    RUN_TEST(test_valid_rule);
+    RUN_TEST(test_category_edges);
+    return UNITY_END();
+}
@@ -0,0 +1,102 @@
+// Native test: pio test -e native -f test_led_trace
+#define LED_TRACE 1
+#include <unity.h>
+#include "led_trace.cpp"
+
+CRGB leds[NUM_LEDS];
+
+#define FULL_FRAME_BYTES  (FRAME_HEADER_BYTES + NUM_LEDS * ENTRY_BYTES)
+
+// ─── Helpers ─────────────────────────────────────────────────
+static void fillAll(uint8_t v) {
+    for (CRGB& px : leds) px = CRGB(v, v, v);
+}
+
+static uint16_t get16(const uint8_t* p) { return p[0] | p[1] << 8; }
+
+static uint32_t get32(const uint8_t* p) { return get16(p) | (uint32_t)get16(p + 2) << 16; }
+
+// Frames in the open trace, walked the way tools/led_trace.py reads them
+static int countFrames() {
+    size_t   at   = HEADER_BYTES + NUM_LEDS * 3;
+    int      n    = 0;
+    uint32_t last = 0;
+    while (at < _len) {
+        TEST_ASSERT_TRUE(get32(_buf + at) >= last);
+        last = get32(_buf + at);
+        at += FRAME_HEADER_BYTES + get16(_buf + at + 6) * ENTRY_BYTES;
+        n++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(_len, at);
+    return n;
+}
+
+// ─── Tests ──────────────────────────────────────────────────
+void setUp() {
+    Serial.muted = true;        // the hex dump on close
+    fillAll(0);
+}
+
+void tearDown() {
+    led_trace_end();
+    Serial.muted = false;
+}
+
+static void test_only_changes_are_recorded() {
+    TEST_ASSERT_TRUE(led_trace_begin("12:00"));
+    TEST_ASSERT_EQUAL_MEMORY("LTR1", _buf, 4);
+    TEST_ASSERT_EQUAL_UINT16(NUM_LEDS, get16(_buf + 4));
+
+    leds[3] = CRGB(1, 2, 3);
+    led_trace_frame(_start_us + 100, 40);
+    led_trace_frame(_start_us + 200, 40);       // nothing changed
+    const uint8_t* f = _buf + HEADER_BYTES + NUM_LEDS * 3;
+    TEST_ASSERT_EQUAL_UINT32(100, get32(f));
+    TEST_ASSERT_EQUAL_UINT16(40, get16(f + 4));
+    TEST_ASSERT_EQUAL_UINT16(1, get16(f + 6));
+    TEST_ASSERT_EQUAL_UINT16(3, get16(f + 8));
+    TEST_ASSERT_EQUAL_UINT8(3, f[12]);
+    TEST_ASSERT_EQUAL_UINT16(0, get16(f + 13 + 6));
+    TEST_ASSERT_EQUAL_INT(2, countFrames());
+    TEST_ASSERT_EQUAL_UINT16(0, get16(_buf + 6));
+}
+
+static void test_nothing_is_appended_after_truncation() {
+    TEST_ASSERT_TRUE(led_trace_begin("12:01"));
+    int fit = (LED_TRACE_BYTES - (int)_len) / FULL_FRAME_BYTES;
+    for (int i = 0; i <= fit; i++) {
+        fillAll(i & 1 ? 0 : 0xFF);
+        led_trace_frame(_start_us + i * 1000, 100);
+    }
+    TEST_ASSERT_EQUAL_UINT16(TRACE_FLAG_TRUNCATED, get16(_buf + 6));
+    TEST_ASSERT_EQUAL_INT(fit, countFrames());
+
+    // Back to the last recorded frame but one LED: small enough to fit, and
+    // must not land after the dropped one
+    size_t len = _len;
+    fillAll((fit - 1) & 1 ? 0 : 0xFF);
+    leds[0] = CRGB(9, 9, 9);
+    led_trace_frame(_start_us + (fit + 1) * 1000, 100);
+    TEST_ASSERT_EQUAL_UINT32(len, _len);
+    TEST_ASSERT_EQUAL_UINT32(fit, _frames);
+
+    led_trace_end();
+    TEST_ASSERT_EQUAL_UINT32(1, _truncated);
+}
+
+static void test_a_new_trace_starts_clean() {
+    TEST_ASSERT_TRUE(led_trace_begin("12:02"));
+    TEST_ASSERT_EQUAL_UINT16(0, get16(_buf + 6));
+    leds[5] = CRGB(4, 5, 6);
+    led_trace_frame(_start_us + 10, 1);
+    TEST_ASSERT_EQUAL_INT(1, countFrames());
+}
+
+int main(int argc, char** argv) {
+    (void)argc; (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_only_changes_are_recorded);
+    RUN_TEST(test_nothing_is_appended_after_truncation);
+    RUN_TEST(test_a_new_trace_starts_clean);
+    return UNITY_END();
+}
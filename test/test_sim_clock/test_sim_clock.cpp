@@ -0,0 +1,198 @@
+// Native test: pio test -e native -f test_sim_clock
+//
+// Runs the word clock through 24 virtual hours on the simulated clock, the
+// way loop() drives it, and checks the greetings, AM/PM and the hour words.
+#define SIM_CLOCK 1
+#include <unity.h>
+#include <vector>
+#include "clock_source.cpp"
+#include "tz.cpp"
+#include "word_face.cpp"
+#include "word_clock.cpp"
+
+#define LOOP_REAL_US   5000                      // real time per loop() pass: its delay(5)
+#define DAY_S          86400
+
+// ─── LED output and animation ───────────────────────────────
+// anim_play() and led_show() only record what would have gone out.
+struct Frame {
+    time_t utc;
+    CRGB   px[NUM_LEDS];
+};
+
+static std::vector<Frame> _shown;
+
+void led_output_begin(CLEDController*) {}
+
+void led_show() {
+    _shown.emplace_back();
+    _shown.back().utc = clock_utc();
+    memcpy(_shown.back().px, leds, sizeof(leds));
+}
+
+float         animationSpeed   = 1.0f;
+AnimationType currentAnimation = ANIM_FADE;
+uint32_t      animationSeed    = 0;
+bool          animationEnabled = false;
+
+void anim_snapshotOld() {}
+void anim_snapshotNew() {}
+void anim_play() { led_show(); }
+
+// ─── Helpers ─────────────────────────────────────────────────
+using namespace face_en;
+
+static bool wordLit(const Frame& f, uint8_t w, CRGB color = CRGB()) {
+    const FaceWord& fw = words[w];
+    for (int k = 0; k < glyphCount(fw.text); k++) {
+        const CRGB& px = f.px[WordMatrix::at(fw.row, fw.col + k)];
+        if (!px || (color && px != color)) return false;
+    }
+    return true;
+}
+
+static int litCount(const Frame& f) {
+    int n = 0;
+    for (const CRGB& px : f.px) n += (bool)px;
+    return n;
+}
+
+// Hour word shown in a time frame, -1 for a greeting frame
+static int hourWord(const Frame& f) {
+    int found = -1;
+    for (int h = H1; h <= H12; h++) {
+        if (!wordLit(f, h)) continue;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(-1, found, "two hour words lit");
+        found = h;
+    }
+    return found;
+}
+
+static void localTime(time_t utc, int& hour, int& minute) {
+    struct tm tm;
+    tz_localtime(utc, &tm);
+    hour   = tm.tm_hour;
+    minute = tm.tm_min;
+}
+
+// main's loop(), reduced to the word clock
+static void runDay() {
+    unsigned long lastClockUpdate = 0;
+    while (clock_utc() < SIM_CLOCK_START_UTC + DAY_S) {
+        clock_sim_job_begin(SIM_JOB_LOOP);
+        unsigned long ms = clock_ms();
+        wordclock_tick();
+        if (lastClockUpdate == 0 || ms - lastClockUpdate >= 60000) {
+            lastClockUpdate = max(ms - ms % 60000, 1UL);
+            int hour, minute;
+            localTime(clock_utc(), hour, minute);
+            clock_sim_job_begin(SIM_JOB_WORDCLOCK);
+            clock_host_advance_us(20000);              // held: must not move the virtual clock
+            wordclock_update(hour, minute);
+            clock_sim_job_end(SIM_JOB_WORDCLOCK);
+        }
+        clock_sim_job_end(SIM_JOB_LOOP);
+        clock_sim_tick();
+        clock_host_advance_us(LOOP_REAL_US);
+    }
+}
+
+// ─── Tests ──────────────────────────────────────────────────
+void setUp() {}
+void tearDown() {}
+
+static void test_clock_rate_and_hold() {
+    time_t  t0 = clock_utc();
+    clock_host_advance_us(60 * 1000000LL);             // one real minute
+    TEST_ASSERT_EQUAL_INT(DAY_S, clock_utc() - t0);
+
+    clock_sim_job_begin(SIM_JOB_SCREEN);
+    clock_host_advance_us(1000000);
+    TEST_ASSERT_EQUAL_INT(DAY_S, clock_utc() - t0);    // held
+    clock_sim_job_end(SIM_JOB_SCREEN);
+    clock_host_advance_us(1000);
+    TEST_ASSERT_EQUAL_INT(DAY_S + 1, clock_utc() - t0);
+}
+
+static void test_a_day_of_updates() {
+    Serial.muted = true;                               // hourly SIM reports
+    runDay();
+    Serial.muted = false;
+
+    bool minuteSeen[24 * 60] = {};
+    int  greetings[4]        = {};
+    int  hourChanges = 0, amPmChanges = 0, lastHourWord = -1, lastPm = -1;
+    int  greetingOpen = -1;                            // index of the frame that started a greeting
+
+    for (size_t i = 0; i < _shown.size(); i++) {
+        const Frame& f = _shown[i];
+        int hour, minute;
+        localTime(f.utc, hour, minute);
+        int hw = hourWord(f);
+
+        if (hw < 0) {
+            // Greeting: its word alone, in its colour
+            static const uint8_t greetWords[4]  = { MORNING, AFTERNOON, EVENING, NIGHT };
+            static const CRGB    greetColors[4] = { COLOR_MORNING, COLOR_AFTERNOON, COLOR_EVENING, COLOR_NIGHT };
+            int g = -1;
+            for (int k = 0; k < 4; k++)
+                if (wordLit(f, greetWords[k], greetColors[k])) g = k;
+            TEST_ASSERT_TRUE_MESSAGE(g >= 0, "frame with neither an hour nor a greeting");
+            TEST_ASSERT_EQUAL_INT(glyphCount(words[greetWords[g]].text), litCount(f));
+            TEST_ASSERT_EQUAL_INT_MESSAGE(0, minute, "greetings start on the hour with fixed schedule");
+            static const int greetHour[4] = { 5, 12, 16, 21 };
+            TEST_ASSERT_EQUAL_INT(greetHour[g], hour);
+            greetings[g]++;
+            greetingOpen = i;
+            continue;
+        }
+
+        // The greeting gives way to the time after GREETING_DURATION_MS, within its minute
+        if (greetingOpen >= 0) {
+            time_t shownFor = f.utc - _shown[greetingOpen].utc;
+            TEST_ASSERT_TRUE(shownFor >= GREETING_DURATION_MS / 1000 && shownFor < 60);
+            greetingOpen = -1;
+        }
+        minuteSeen[hour * 60 + minute] = true;
+
+        // Hour word: the coming hour from :33 on ("ALMOST TWENTY FIVE MINUTES TO")
+        int shown = (hour + (minute >= 33 ? 1 : 0)) % 24;
+        TEST_ASSERT_EQUAL_INT(hours[shown % 12], hw);
+        if (hw != lastHourWord) {
+            if (lastHourWord >= 0) hourChanges++;
+            lastHourWord = hw;
+        }
+
+        // AM/PM follows the hour being named, in its own colour
+        bool pm = shown >= 12;
+        TEST_ASSERT_TRUE(wordLit(f, pm ? PM : AM, pm ? COLOR_PM : COLOR_AM));
+        TEST_ASSERT_FALSE(wordLit(f, pm ? AM : PM));
+        if (lastPm >= 0 && pm != (bool)lastPm) amPmChanges++;
+        lastPm = pm;
+
+        // IT IS always, in the day or night colour
+        CRGB timeColor = (hour < 6 || hour >= 18) ? COLOR_TIME_NIGHT : COLOR_TIME;
+        TEST_ASSERT_TRUE(wordLit(f, IT, timeColor) && wordLit(f, IS, timeColor));
+    }
+
+    for (int m = 0; m < 24 * 60; m++) TEST_ASSERT_TRUE_MESSAGE(minuteSeen[m], "a minute was skipped");
+    // No greeting straight after boot (00:00 is already night); one per period after that
+    TEST_ASSERT_EQUAL_INT(1, greetings[0]);
+    TEST_ASSERT_EQUAL_INT(1, greetings[1]);
+    TEST_ASSERT_EQUAL_INT(1, greetings[2]);
+    TEST_ASSERT_EQUAL_INT(1, greetings[3]);
+    TEST_ASSERT_EQUAL_INT(24, hourChanges);            // 00:33 … 23:33, the last one back to TWELVE
+    TEST_ASSERT_EQUAL_INT(2, amPmChanges);             // at 11:33 and 23:33
+    TEST_ASSERT_EQUAL_INT(1440 + 4, (int)_shown.size());   // a frame per minute, plus the end of each greeting
+}
+
+int main(int argc, char** argv) {
+    (void)argc; (void)argv;
+    tz_set("Asia/Kolkata");                            // SIM_CLOCK_START_UTC is local midnight there
+    clock_begin();
+    wordclock_init();
+    UNITY_BEGIN();
+    RUN_TEST(test_a_day_of_updates);
+    RUN_TEST(test_clock_rate_and_hold);
+    return UNITY_END();
+}
@@ -0,0 +1,197 @@
+// Native test and parse-time report: pio test -e native -f test_weather_parse -v
+//
+// Runs the firmware's weatherapi parser over every recorded response in
+// tools/replay (see tools/weather_replay.py record), over every truncation
+// of them and over the error bodies the service and the replay server send.
+// Times are host times: compare runs against each other, not with the ESP32.
+#include <unity.h>
+#include <dirent.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "weather_provider.cpp"
+#include "aqi.cpp"
+
+#ifndef REPLAY_DIR
+#define REPLAY_DIR  "tools/replay"          // relative to the project, where pio runs tests
+#endif
+#define PARSE_RUNS  200                     // timed parses per recording
+
+// ─── Helpers ─────────────────────────────────────────────────
+struct Recording {
+    std::string name;
+    std::string body;
+};
+
+static std::string replayDir;
+
+// REPLAY_DIR as given, else found from this file's path (test/<name>/) when
+// the runner starts somewhere other than the project root.
+static DIR* openReplayDir() {
+    replayDir = REPLAY_DIR;
+    DIR* dir  = opendir(replayDir.c_str());
+    if (dir || replayDir[0] == '/') return dir;
+    std::string here = __FILE__;
+    for (int up = 0; up < 3; up++) {
+        size_t slash = here.find_last_of('/');
+        if (slash == std::string::npos) return NULL;
+        here.erase(slash);
+    }
+    replayDir = here + "/" + REPLAY_DIR;
+    return opendir(replayDir.c_str());
+}
+
+static std::vector<Recording> loadRecordings() {
+    std::vector<Recording> out;
+    DIR* dir = openReplayDir();
+    if (!dir) return out;
+    while (dirent* e = readdir(dir)) {
+        std::string name = e->d_name;
+        if (name.compare(0, 8, "current_") != 0 || name.size() < 5 ||
+            name.compare(name.size() - 5, 5, ".json") != 0) continue;
+        FILE* f = fopen((replayDir + "/" + name).c_str(), "rb");
+        if (!f) continue;
+        std::string body;
+        char        chunk[1024];
+        size_t      n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) body.append(chunk, n);
+        fclose(f);
+        out.push_back({ name, body });
+    }
+    closedir(dir);
+    std::sort(out.begin(), out.end(), [](const Recording& a, const Recording& b) { return a.name < b.name; });
+    return out;
+}
+
+static bool parse(const std::string& body, WeatherSample& out) {
+    return weatherapi_provider.parse(body.data(), body.size(), out);
+}
+
+static double micros(std::chrono::steady_clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+static std::vector<Recording> recordings;
+
+// ─── Tests ──────────────────────────────────────────────────
+void setUp() { Serial.muted = false; }
+void tearDown() {}
+
+static void test_recordings_parse() {
+    std::string missing = "no " + replayDir + "/current_*.json found";
+    TEST_ASSERT_TRUE_MESSAGE(!recordings.empty(), missing.c_str());
+
+    for (const Recording& r : recordings) {
+        WeatherSample s;
+        double        total = 0, worst = 0;
+        bool          ok    = true;
+        for (int i = 0; i < PARSE_RUNS && ok; i++) {
+            auto t0 = std::chrono::steady_clock::now();
+            ok      = parse(r.body, s);
+            double us = micros(std::chrono::steady_clock::now() - t0);
+            total += us;
+            if (us > worst) worst = us;
+        }
+        TEST_ASSERT_TRUE_MESSAGE(ok, r.name.c_str());
+
+        long updated, server;
+        weatherapi_provider.peek(r.body.data(), r.body.size(), &updated, &server);
+        TEST_ASSERT_EQUAL_MESSAGE(updated, s.updated_epoch, r.name.c_str());
+        TEST_ASSERT_EQUAL_MESSAGE(server, s.server_epoch, r.name.c_str());
+        TEST_ASSERT_TRUE_MESSAGE(s.temp_c > -90 && s.temp_c < 60, r.name.c_str());
+        TEST_ASSERT_TRUE_MESSAGE(s.humidity >= 0 && s.humidity <= 100, r.name.c_str());
+        TEST_ASSERT_TRUE_MESSAGE(s.code >= 1000 && s.code <= 1282, r.name.c_str());
+        TEST_ASSERT_TRUE_MESSAGE(s.is_day == 0 || s.is_day == 1, r.name.c_str());
+
+        AqiResult aqi = s.has_aqi ? aqi_compute(s.conc) : AqiResult{};
+        printf("%-20s %6zu B  parse avg %7.1f us  max %7.1f us | %.1f C %.0f%% code %d %s | AQI %d %s%s\n",
+               r.name.c_str(), r.body.size(), total / PARSE_RUNS, worst, s.temp_c, s.humidity, s.code,
+               s.is_day ? "day" : "night", s.has_aqi ? aqi.aqi : AQI_MISSING,
+               s.has_aqi ? aqi_pollutant_name(aqi.dominant) : "-",
+               s.has_aqi && !aqi.valid ? " [incomplete]" : "");
+    }
+}
+
+// Every prefix that cuts into the document must be rejected.
+static void test_truncated_recordings_fail() {
+    for (const Recording& r : recordings) {
+        size_t end = r.body.find_last_of('}');
+        TEST_ASSERT_TRUE(end != std::string::npos);
+        WeatherSample s;
+        size_t        accepted = 0;
+        double        total    = 0;
+        Serial.muted = true;
+        for (size_t len = 0; len <= end; len++) {
+            auto t0 = std::chrono::steady_clock::now();
+            if (weatherapi_provider.parse(r.body.data(), len, s)) accepted++;
+            total += micros(std::chrono::steady_clock::now() - t0);
+        }
+        Serial.muted = false;
+        printf("%-20s %6zu truncations rejected, avg %.1f us\n", r.name.c_str(), end + 1 - accepted,
+               total / (end + 1));
+        TEST_ASSERT_EQUAL_MESSAGE(0, accepted, r.name.c_str());
+    }
+}
+
+static void test_error_bodies_fail() {
+    static const char* const bodies[] = {
+        "",
+        "{}",
+        "null",
+        "[]",
+        "{\"error\":{\"code\":1006,\"message\":\"No matching location found.\"}}",
+        "{\"error\":{\"code\":2008,\"message\":\"API key has been disabled.\"}}",
+        "{\"error\":{\"code\":9999,\"message\":\"Internal application error.\"}}",
+        "{\"error\":{\"code\":1005,\"message\":\"API request url is invalid.\"}}",
+        "<html><head><title>502 Bad Gateway</title></head><body>nginx</body></html>",
+        "{\"current\":null}",
+        "{\"current\":{}}",
+        "{\"current\":{\"temp_c\":21.5}}",                                      // no condition
+        "{\"current\":{\"condition\":{\"code\":1000}}}",                          // no temperature
+        "{\"current\":{\"temp_c\":\"hot\",\"condition\":{\"code\":1000}}}",
+        "{\"current\":{\"temp_c\":21.5,\"condition\":{\"code\":\"1000\"}}}",
+    };
+    WeatherSample s;
+    for (const char* b : bodies) {
+        auto t0 = std::chrono::steady_clock::now();
+        bool ok = weatherapi_provider.parse(b, strlen(b), s);
+        printf("%7.1f us  %s  %.50s\n", micros(std::chrono::steady_clock::now() - t0), ok ? "accepted" : "rejected", b);
+        TEST_ASSERT_FALSE_MESSAGE(ok, b);
+    }
+}
+
+static void test_optional_fields_default() {
+    const char* body = "{\"current\":{\"temp_c\":-3.5,\"humidity\":81,\"condition\":{\"code\":1213}}}";
+    WeatherSample s;
+    TEST_ASSERT_TRUE(weatherapi_provider.parse(body, strlen(body), s));
+    TEST_ASSERT_TRUE(s.temp_c == -3.5f);
+    TEST_ASSERT_EQUAL_INT(1213, s.code);
+    TEST_ASSERT_EQUAL_INT(1, s.is_day);
+    TEST_ASSERT_EQUAL(-1, s.updated_epoch);
+    TEST_ASSERT_EQUAL(-1, s.server_epoch);
+    TEST_ASSERT_FALSE(s.has_aqi);
+    for (int p = 0; p < AQI_POLLUTANT_COUNT; p++) TEST_ASSERT_EQUAL_INT(AQI_MISSING, s.conc[p]);
+
+    // Pollutants the service leaves out stay missing
+    body = "{\"current\":{\"temp_c\":30,\"is_day\":0,\"condition\":{\"code\":1000},"
+           "\"air_quality\":{\"pm2_5\":42.25,\"co\":310.8,\"us-epa-index\":2}}}";
+    TEST_ASSERT_TRUE(weatherapi_provider.parse(body, strlen(body), s));
+    TEST_ASSERT_EQUAL_INT(0, s.is_day);
+    TEST_ASSERT_TRUE(s.has_aqi);
+    TEST_ASSERT_EQUAL_INT(423, s.conc[AQI_PM25]);
+    TEST_ASSERT_EQUAL_INT(3108, s.conc[AQI_CO]);
+    TEST_ASSERT_EQUAL_INT(AQI_MISSING, s.conc[AQI_PM10]);
+    TEST_ASSERT_EQUAL_INT(AQI_MISSING, s.conc[AQI_O3]);
+}
+
+int main(int argc, char** argv) {
+    (void)argc; (void)argv;
+    recordings = loadRecordings();
+    UNITY_BEGIN();
+    RUN_TEST(test_recordings_parse);
+    RUN_TEST(test_truncated_recordings_fail);
+    RUN_TEST(test_error_bodies_fail);
+    RUN_TEST(test_optional_fields_default);
+    return UNITY_END();
+}
@@ -0,0 +1,174 @@
+// Native test: pio test -e native -f test_weather_theme
+#include <unity.h>
+#include "weather_theme.cpp"
+
+// ─── UI objects ─────────────────────────────────────────────
+// Normally created by ui_init(); the theme only needs them to exist.
+static lv_obj_t sun, moon, cloud, rain, fog, cloudyNight, screen, desc, temp, celcius;
+
+extern "C" {
+lv_obj_t* ui_SunIcon         = &sun;
+lv_obj_t* ui_MoonIcon        = &moon;
+lv_obj_t* ui_CloudIcon       = &cloud;
+lv_obj_t* ui_RainIcon        = &rain;
+lv_obj_t* ui_FogIcon         = &fog;
+lv_obj_t* ui_CloudyNightIcon = &cloudyNight;
+lv_obj_t* ui_Outdoor_Weather = &screen;
+lv_obj_t* ui_WeatherDesc     = &desc;
+lv_obj_t* ui_OutdoorTemp     = &temp;
+lv_obj_t* ui_Celcious        = &celcius;
+
+lv_anim_t* RotatingSun_Animation(lv_obj_t* target, int delay) {
+    (void)delay;
+    target->anims++;
+    return nullptr;
+}
+}
+
+// ─── Expected data ──────────────────────────────────────────
+// The full condition list from weatherapi.com/docs/weather_conditions.json
+struct Expected {
+    int             code;
+    WeatherCategory category;
+    const char*     text;
+};
+
+static const Expected conditions[] = {
+    { 1000, WX_CLEAR,  "Sunny / Clear" },
+    { 1003, WX_CLOUDY, "Partly cloudy" },
+    { 1006, WX_CLOUDY, "Cloudy" },
+    { 1009, WX_CLOUDY, "Overcast" },
+    { 1030, WX_FOG,    "Mist" },
+    { 1063, WX_RAIN,   "Patchy rain possible" },
+    { 1066, WX_SNOW,   "Patchy snow possible" },
+    { 1069, WX_SNOW,   "Patchy sleet possible" },
+    { 1072, WX_RAIN,   "Patchy freezing drizzle possible" },
+    { 1087, WX_STORM,  "Thundery outbreaks possible" },
+    { 1114, WX_SNOW,   "Blowing snow" },
+    { 1117, WX_SNOW,   "Blizzard" },
+    { 1135, WX_FOG,    "Fog" },
+    { 1147, WX_FOG,    "Freezing fog" },
+    { 1150, WX_RAIN,   "Patchy light drizzle" },
+    { 1153, WX_RAIN,   "Light drizzle" },
+    { 1168, WX_RAIN,   "Freezing drizzle" },
+    { 1171, WX_RAIN,   "Heavy freezing drizzle" },
+    { 1180, WX_RAIN,   "Patchy light rain" },
+    { 1183, WX_RAIN,   "Light rain" },
+    { 1186, WX_RAIN,   "Moderate rain at times" },
+    { 1189, WX_RAIN,   "Moderate rain" },
+    { 1192, WX_RAIN,   "Heavy rain at times" },
+    { 1195, WX_RAIN,   "Heavy rain" },
+    { 1198, WX_RAIN,   "Light freezing rain" },
+    { 1201, WX_RAIN,   "Moderate or heavy freezing rain" },
+    { 1204, WX_SNOW,   "Light sleet" },
+    { 1207, WX_SNOW,   "Moderate or heavy sleet" },
+    { 1210, WX_SNOW,   "Patchy light snow" },
+    { 1213, WX_SNOW,   "Light snow" },
+    { 1216, WX_SNOW,   "Patchy moderate snow" },
+    { 1219, WX_SNOW,   "Moderate snow" },
+    { 1222, WX_SNOW,   "Patchy heavy snow" },
+    { 1225, WX_SNOW,   "Heavy snow" },
+    { 1237, WX_SNOW,   "Ice pellets" },
+    { 1240, WX_RAIN,   "Light rain shower" },
+    { 1243, WX_RAIN,   "Moderate or heavy rain shower" },
+    { 1246, WX_RAIN,   "Torrential rain shower" },
+    { 1249, WX_SNOW,   "Light sleet showers" },
+    { 1252, WX_SNOW,   "Moderate or heavy sleet showers" },
+    { 1255, WX_SNOW,   "Light snow showers" },
+    { 1258, WX_SNOW,   "Moderate or heavy snow showers" },
+    { 1261, WX_SNOW,   "Light showers of ice pellets" },
+    { 1264, WX_SNOW,   "Moderate or heavy showers of ice pellets" },
+    { 1273, WX_STORM,  "Patchy light rain with thunder" },
+    { 1276, WX_STORM,  "Moderate or heavy rain with thunder" },
+    { 1279, WX_STORM,  "Patchy light snow with thunder" },
+    { 1282, WX_STORM,  "Moderate or heavy snow with thunder" },
+};
+#define CONDITION_COUNT (sizeof(conditions) / sizeof(conditions[0]))
+
+// What the Outdoor_Weather screen should show per category, [night, day]
+struct Look {
+    lv_obj_t*   icon[2];
+    const char* description;
+    bool        spinsByDay;
+};
+
+static const Look looks[WX_COUNT] = {
+    /* CLEAR  */ { { &moon,        &sun   }, "Clear",  true  },
+    /* CLOUDY */ { { &cloudyNight, &cloud }, "Cloudy", false },
+    /* FOG    */ { { &fog,         &fog   }, "Foggy",  false },
+    /* RAIN   */ { { &rain,        &rain  }, "Rainy",  false },
+    /* SNOW   */ { { &cloudyNight, &cloud }, "Snowy",  false },
+    /* STORM  */ { { &rain,        &rain  }, "Stormy", false },
+};
+
+static bool isListed(int code) {
+    for (const Expected& e : conditions)
+        if (e.code == code) return true;
+    return false;
+}
+
+// ─── Tests ──────────────────────────────────────────────────
+void setUp() {
+    for (lv_obj_t** icon : icons) **icon = lv_obj_t{};
+}
+
+void tearDown() {}
+
+static void test_table_covers_every_code() {
+    TEST_ASSERT_EQUAL_UINT(CONDITION_COUNT, WEATHER_CODE_COUNT);
+    for (size_t i = 1; i < WEATHER_CODE_COUNT; i++)
+        TEST_ASSERT_TRUE_MESSAGE(codes[i - 1].code < codes[i].code, "codes[] must stay sorted");
+}
+
+static void test_every_code_has_its_category() {
+    for (const Expected& e : conditions)
+        TEST_ASSERT_EQUAL_INT_MESSAGE(e.category, weather_category(e.code), e.text);
+}
+
+static void test_unknown_codes_are_clear() {
+    for (int code = 900; code <= 1400; code++)
+        if (!isListed(code)) TEST_ASSERT_EQUAL_INT(WX_CLEAR, weather_category(code));
+    TEST_ASSERT_EQUAL_INT(WX_CLEAR, weather_category(0));
+    TEST_ASSERT_EQUAL_INT(WX_CLEAR, weather_category(-1));
+}
+
+static void test_every_code_day_and_night() {
+    for (const Expected& e : conditions) {
+        const Look& look = looks[e.category];
+        for (int day = 0; day <= 1; day++) {
+            const WeatherTheme& t = weather_theme(e.code, day);
+            TEST_ASSERT_EQUAL_PTR_MESSAGE(look.icon[day], *t.icon, e.text);
+            TEST_ASSERT_EQUAL_STRING_MESSAGE(look.description, t.description, e.text);
+            TEST_ASSERT_EQUAL_MESSAGE(day && look.spinsByDay, t.animation != nullptr, e.text);
+            TEST_ASSERT_EQUAL_MESSAGE(&themes[e.category][day], &t, e.text);
+        }
+        // weatherapi sends is_day as 0/1; anything non-zero is day
+        TEST_ASSERT_EQUAL_PTR(&weather_theme(e.code, 1), &weather_theme(e.code, 7));
+    }
+}
+
+static void test_apply_shows_only_the_themed_icon() {
+    for (const Expected& e : conditions) {
+        for (int day = 0; day <= 1; day++) {
+            setUp();
+            weather_theme_apply(e.code, day);
+            const WeatherTheme& t = weather_theme(e.code, day);
+            for (lv_obj_t** icon : icons)
+                TEST_ASSERT_EQUAL_MESSAGE(*icon != *t.icon, lv_obj_has_flag(*icon, LV_OBJ_FLAG_HIDDEN), e.text);
+            TEST_ASSERT_EQUAL_HEX32(t.background, screen.bg_color);
+            TEST_ASSERT_EQUAL_HEX32(t.text, desc.text_color);
+            TEST_ASSERT_EQUAL_INT(t.animation ? 1 : 0, (*t.icon)->anims);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    (void)argc; (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_table_covers_every_code);
+    RUN_TEST(test_every_code_has_its_category);
+    RUN_TEST(test_unknown_codes_are_clear);
+    RUN_TEST(test_every_code_day_and_night);
+    RUN_TEST(test_apply_shows_only_the_themed_icon);
+    return UNITY_END();
+}
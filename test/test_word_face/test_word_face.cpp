@@ -0,0 +1,321 @@
+// Native test: pio test -e native -f test_word_face
+//
+// The default face (en-almost) must light exactly what the hand-written
+// lightTime() did before the faces became data; the other faces are checked
+// phrase by phrase at every five-minute step.
+#include <unity.h>
+#include <string>
+#include "word_face.cpp"
+#include "word_clock.cpp"
+
+static_assert(WORDCLOCK_FACE == FACE_EN_ALMOST, "the golden table is for en-almost");
+
+// ─── Links word_clock.cpp needs ─────────────────────────────
+unsigned long clock_ms() { return 0; }
+void          led_output_begin(CLEDController*) {}
+void          led_show() {}
+
+float         animationSpeed   = 1.0f;
+AnimationType currentAnimation = ANIM_FADE;
+uint32_t      animationSeed    = 0;
+bool          animationEnabled = false;
+
+void anim_snapshotOld() {}
+void anim_snapshotNew() {}
+void anim_play() {}
+
+// ─── Golden ─────────────────────────────────────────────────
+// FNV-1a over leds[] after lightTime(h, m) with COLOR_TIME, for every minute
+// of the day from 00:00, as produced by lightTime() before the faces change
+// (its phrase buckets and ledIndex() wiring, built on the host).
+static const uint32_t oldLightTime[24 * 60] = {
+    0x94e03035, 0x94e03035, 0x94e03035, 0x3c295456, 0x3c295456, 0x08e2cedc, 0x08e2cedc, 0x08e2cedc,
+    0x561144fb, 0x561144fb, 0x86c6e5d5, 0x86c6e5d5, 0x86c6e5d5, 0x42b09ba3, 0x42b09ba3, 0x4b9fad7d,
+    0x4b9fad7d, 0x4b9fad7d, 0x068fb6a4, 0x068fb6a4, 0x2e8eb3ea, 0x2e8eb3ea, 0x2e8eb3ea, 0x69efeeb0,
+    0x69efeeb0, 0x7a163756, 0x7a163756, 0x7a163756, 0x24fa555d, 0x24fa555d, 0x1ff9fb87, 0x1ff9fb87,
+    0x1ff9fb87, 0xd3f3a605, 0xd3f3a605, 0xc643b90f, 0xc643b90f, 0xc643b90f, 0x35cf8c81, 0x35cf8c81,
+    0x8d569f2b, 0x8d569f2b, 0x8d569f2b, 0x848a1b22, 0x848a1b22, 0xbce12658, 0xbce12658, 0xbce12658,
+    0x3d3af58a, 0x3d3af58a, 0xc8614da0, 0xc8614da0, 0xc8614da0, 0x67c0c73f, 0x67c0c73f, 0xf6bc15a9,
+    0xf6bc15a9, 0xf6bc15a9, 0x75751e50, 0x75751e50, 0xd13f1b76, 0xd13f1b76, 0xd13f1b76, 0xa4199e81,
+    0xa4199e81, 0xfba0b12b, 0xfba0b12b, 0xfba0b12b, 0xf16fc7ec, 0xf16fc7ec, 0xc7afb652, 0xc7afb652,
+    0xc7afb652, 0x8a7855b4, 0x8a7855b4, 0xf0b052fa, 0xf0b052fa, 0xf0b052fa, 0x55197263, 0x55197263,
+    0x1ce05e3d, 0x1ce05e3d, 0x1ce05e3d, 0x1edb3a87, 0x1edb3a87, 0xd45803b1, 0xd45803b1, 0xd45803b1,
+    0x6f91edba, 0x6f91edba, 0xec0ff750, 0xec0ff750, 0xec0ff750, 0x5befce11, 0x5befce11, 0x10300cbb,
+    0x10300cbb, 0x10300cbb, 0x1beda4fd, 0x1beda4fd, 0xc91d77a7, 0xc91d77a7, 0xc91d77a7, 0x7eabd8de,
+    0x7eabd8de, 0x7a28aa64, 0x7a28aa64, 0x7a28aa64, 0xb7e902d6, 0xb7e902d6, 0xbebb435c, 0xbebb435c,
+    0xbebb435c, 0x124c594b, 0x124c594b, 0xe28938a5, 0xe28938a5, 0xe28938a5, 0x9318c5e0, 0x9318c5e0,
+    0x69ad6586, 0x69ad6586, 0x69ad6586, 0x661a4b69, 0x661a4b69, 0x4f754893, 0x4f754893, 0x4f754893,
+    0xc177de54, 0xc177de54, 0x6404a41a, 0x6404a41a, 0x6404a41a, 0xa527a47c, 0xa527a47c, 0x56aaaa62,
+    0x56aaaa62, 0x56aaaa62, 0x64aad1ab, 0x64aad1ab, 0x4bdda885, 0x4bdda885, 0x4bdda885, 0x8b1573af,
+    0x8b1573af, 0xca25ee99, 0xca25ee99, 0xca25ee99, 0x1044bf22, 0x1044bf22, 0x489bca58, 0x489bca58,
+    0x489bca58, 0x142cb6c9, 0x142cb6c9, 0xcc9b3173, 0xcc9b3173, 0xcc9b3173, 0xc6273995, 0xc6273995,
+    0x68c8e49f, 0x68c8e49f, 0x68c8e49f, 0xcd399fd6, 0xcd399fd6, 0xd40be05c, 0xd40be05c, 0xd40be05c,
+    0x4bf5652e, 0x4bf5652e, 0x587c13b4, 0x587c13b4, 0x587c13b4, 0xdd284343, 0xdd284343, 0x9143a51d,
+    0x9143a51d, 0x9143a51d, 0x9875c5d8, 0x9875c5d8, 0x40e4c4fe, 0x40e4c4fe, 0x40e4c4fe, 0x6f751d81,
+    0x6f751d81, 0xc6fc302b, 0xc6fc302b, 0xc6fc302b, 0xbccb46ec, 0xbccb46ec, 0x930b3552, 0x930b3552,
+    0x930b3552, 0x55d3d4b4, 0x55d3d4b4, 0xbc0bd1fa, 0xbc0bd1fa, 0xbc0bd1fa, 0x2074f163, 0x2074f163,
+    0xe83bdd3d, 0xe83bdd3d, 0xe83bdd3d, 0xea36b987, 0xea36b987, 0x9fb382b1, 0x9fb382b1, 0x9fb382b1,
+    0x3aed6cba, 0x3aed6cba, 0xb76b7650, 0xb76b7650, 0xb76b7650, 0xb912eb40, 0xb912eb40, 0x0bd13666,
+    0x0bd13666, 0x0bd13666, 0xb520fb34, 0xb520fb34, 0xd36aea7a, 0xd36aea7a, 0xd36aea7a, 0xad16c493,
+    0xad16c493, 0xfb3a15ed, 0xfb3a15ed, 0xfb3a15ed, 0x4f957ceb, 0x4f957ceb, 0xe40f73c5, 0xe40f73c5,
+    0xe40f73c5, 0xa6f6dde6, 0xa6f6dde6, 0x4034886c, 0x4034886c, 0x4034886c, 0xe8c0bebd, 0xe8c0bebd,
+    0x52de9567, 0x52de9567, 0x52de9567, 0x00469ea8, 0x00469ea8, 0x9d821cce, 0x9d821cce, 0x9d821cce,
+    0xd119484d, 0xd119484d, 0xfeb8ed77, 0xfeb8ed77, 0xfeb8ed77, 0x596f0045, 0x596f0045, 0x5b9ae34f,
+    0x5b9ae34f, 0x5b9ae34f, 0x6559f1e6, 0x6559f1e6, 0xfe979c6c, 0xfe979c6c, 0xfe979c6c, 0x9d74c802,
+    0x9d74c802, 0x625952b8, 0x625952b8, 0x625952b8, 0x5f81b73f, 0x5f81b73f, 0xee7d05a9, 0xee7d05a9,
+    0xee7d05a9, 0x17e8f940, 0x17e8f940, 0x6aa74466, 0x6aa74466, 0x6aa74466, 0x13f70934, 0x13f70934,
+    0x3240f87a, 0x3240f87a, 0x3240f87a, 0x0becd293, 0x0becd293, 0x5a1023ed, 0x5a1023ed, 0x5a1023ed,
+    0xae6b8aeb, 0xae6b8aeb, 0x42e581c5, 0x42e581c5, 0x42e581c5, 0x05ccebe6, 0x05ccebe6, 0x9f0a966c,
+    0x9f0a966c, 0x9f0a966c, 0xb45fea3d, 0xb45fea3d, 0x5e8684e7, 0x5e8684e7, 0x5e8684e7, 0x5f1caca8,
+    0x5f1caca8, 0xfc582ace, 0xfc582ace, 0xfc582ace, 0x2fef564d, 0x2fef564d, 0x5d8efb77, 0x5d8efb77,
+    0x5d8efb77, 0xb8450e45, 0xb8450e45, 0xba70f14f, 0xba70f14f, 0xba70f14f, 0xc42fffe6, 0xc42fffe6,
+    0x5d6daa6c, 0x5d6daa6c, 0x5d6daa6c, 0xfc4ad602, 0xfc4ad602, 0xc12f60b8, 0xc12f60b8, 0xc12f60b8,
+    0xbe57c53f, 0xbe57c53f, 0x4d5313a9, 0x4d5313a9, 0x4d5313a9, 0x5f1dde19, 0x5f1dde19, 0x3a72c943,
+    0x3a72c943, 0x3a72c943, 0x02d29065, 0x02d29065, 0xef89d2ef, 0xef89d2ef, 0xef89d2ef, 0x5b4c8006,
+    0x5b4c8006, 0xd8b2548c, 0xd8b2548c, 0xd8b2548c, 0xc8e8665e, 0xc8e8665e, 0xfe7dfde4, 0xfe7dfde4,
+    0xfe7dfde4, 0x3aabd893, 0x3aabd893, 0x88cf29ed, 0x88cf29ed, 0x88cf29ed, 0xa486b068, 0xa486b068,
+    0x2766da8e, 0x2766da8e, 0x2766da8e, 0xe9a09351, 0xe9a09351, 0x5fd789fb, 0x5fd789fb, 0x5fd789fb,
+    0xb8e2419c, 0xb8e2419c, 0x00f90e02, 0x00f90e02, 0x00f90e02, 0x00715f64, 0x00715f64, 0x1e115daa,
+    0x1e115daa, 0x1e115daa, 0xc568ee33, 0xc568ee33, 0x298a520d, 0x298a520d, 0x298a520d, 0x1f62c457,
+    0x1f62c457, 0x13906901, 0x13906901, 0x13906901, 0xa112ea6a, 0xa112ea6a, 0x96337080, 0x96337080,
+    0x96337080, 0xf5ff7b51, 0xf5ff7b51, 0x6c3671fb, 0x6c3671fb, 0x6c3671fb, 0x261dda3d, 0x261dda3d,
+    0xd04474e7, 0xd04474e7, 0xd04474e7, 0x31a0729e, 0x31a0729e, 0x62678e24, 0x62678e24, 0x62678e24,
+    0xb3058596, 0xb3058596, 0xd41c041c, 0xd41c041c, 0xd41c041c, 0xdd29fb8b, 0xdd29fb8b, 0x460897e5,
+    0x460897e5, 0x460897e5, 0x42491fc0, 0x42491fc0, 0x0f33f6e6, 0x0f33f6e6, 0x0f33f6e6, 0xec711aa9,
+    0xec711aa9, 0x51c059d3, 0x51c059d3, 0x51c059d3, 0xd7328d14, 0xd7328d14, 0xc05918da, 0xc05918da,
+    0xc05918da, 0xdf84263c, 0xdf84263c, 0xb28b2822, 0xb28b2822, 0xb28b2822, 0x53c5e5eb, 0x53c5e5eb,
+    0xe83fdcc5, 0xe83fdcc5, 0xe83fdcc5, 0x6e1647ef, 0x6e1647ef, 0x17a8a4d9, 0x17a8a4d9, 0x17a8a4d9,
+    0x79b8dce2, 0x79b8dce2, 0x814eb818, 0x814eb818, 0x814eb818, 0x3511eb5f, 0x3511eb5f, 0x33edd9c9,
+    0x33edd9c9, 0x33edd9c9, 0x654943db, 0x654943db, 0x59e83cb5, 0x59e83cb5, 0x59e83cb5, 0x76f7624c,
+    0x76f7624c, 0xad5f0f32, 0xad5f0f32, 0xad5f0f32, 0xab522424, 0xab522424, 0xfdf0896a, 0xfdf0896a,
+    0xfdf0896a, 0x9b1b9519, 0x9b1b9519, 0x76708043, 0x76708043, 0x76708043, 0x06f07e9e, 0x06f07e9e,
+    0x37b79a24, 0x37b79a24, 0x37b79a24, 0xbabc87e7, 0xbabc87e7, 0x2266db11, 0x2266db11, 0x2266db11,
+    0x9ec4cab2, 0x9ec4cab2, 0x10763268, 0x10763268, 0x10763268, 0xe65cf32a, 0xe65cf32a, 0x2c624740,
+    0x2c624740, 0x2c624740, 0x2171d449, 0x2171d449, 0x6a7ea0f3, 0x6a7ea0f3, 0x6a7ea0f3, 0x7786104d,
+    0x7786104d, 0xa525b577, 0xa525b577, 0xa525b577, 0x70b67de0, 0x70b67de0, 0x474b1d86, 0x474b1d86,
+    0x474b1d86, 0x974cafe8, 0x974cafe8, 0xe2e8ec0e, 0xe2e8ec0e, 0xe2e8ec0e, 0x3f65a09c, 0x3f65a09c,
+    0x877c6d02, 0x877c6d02, 0x877c6d02, 0x28fe1c3b, 0x28fe1c3b, 0x4ef67115, 0x4ef67115, 0x4ef67115,
+    0xbcbb68d3, 0xbcbb68d3, 0xe588fc2d, 0xe588fc2d, 0xe588fc2d, 0x4bd1d14e, 0x4bd1d14e, 0x6a4c3254,
+    0x6a4c3254, 0x6a4c3254, 0x84683265, 0x84683265, 0x711f74ef, 0x711f74ef, 0x711f74ef, 0x00afa010,
+    0x00afa010, 0xba317536, 0xba317536, 0xba317536, 0xeef882d5, 0xeef882d5, 0xeb16b6df, 0xeb16b6df,
+    0xeb16b6df, 0xfce2d00d, 0xfce2d00d, 0x6b31c037, 0x6b31c037, 0x6b31c037, 0x86d5050e, 0x86d5050e,
+    0x73264914, 0x73264914, 0x73264914, 0x58bdb60a, 0x58bdb60a, 0xc311e620, 0xc311e620, 0xc311e620,
+    0x5f858b27, 0x5f858b27, 0xb71b2d51, 0xb71b2d51, 0xb71b2d51, 0xd09b8c37, 0xd09b8c37, 0xf7710de1,
+    0xf7710de1, 0xf7710de1, 0x7cfe2413, 0x7cfe2413, 0x8b18b16d, 0x8b18b16d, 0x8b18b16d, 0x184a0084,
+    0x184a0084, 0x2d809aca, 0x2d809aca, 0x2d809aca, 0x7f12ddbc, 0x7f12ddbc, 0xc97193a2, 0xc97193a2,
+    0xc97193a2, 0x7d14f3b1, 0x7d14f3b1, 0x2336a1db, 0x2336a1db, 0x2336a1db, 0x7f244686, 0x7f244686,
+    0x1d5c430c, 0x1d5c430c, 0x1d5c430c, 0x5d57959f, 0x5d57959f, 0xfce11b09, 0xfce11b09, 0xfce11b09,
+    0xbd7fc32a, 0xbd7fc32a, 0x03851740, 0x03851740, 0x03851740, 0x5edfa0c2, 0x5edfa0c2, 0xd3779778,
+    0xd3779778, 0xd3779778, 0xa8194261, 0xa8194261, 0x2c1ab78b, 0x2c1ab78b, 0x2c1ab78b, 0x5e5cbb65,
+    0x5e5cbb65, 0x4b13fdef, 0x4b13fdef, 0x4b13fdef, 0xe6c6aa58, 0xe6c6aa58, 0x7c93537e, 0x7c93537e,
+    0x7c93537e, 0xbfc088e2, 0xbfc088e2, 0xc7566418, 0xc7566418, 0xc7566418, 0xcb4593c6, 0xcb4593c6,
+    0x7782c24c, 0x7782c24c, 0x7782c24c, 0xbf0ba565, 0xbf0ba565, 0xabc2e7ef, 0xabc2e7ef, 0xabc2e7ef,
+    0x00c9956d, 0x00c9956d, 0x47c87497, 0x47c87497, 0x47c87497, 0x9025b708, 0x9025b708, 0x5ba7932e,
+    0x5ba7932e, 0x5ba7932e, 0x5b943baf, 0x5b943baf, 0x9aa4b699, 0x9aa4b699, 0x9aa4b699, 0x66e066fa,
+    0x66e066fa, 0xe2d6d790, 0xe2d6d790, 0xe2d6d790, 0xb1eab51f, 0xb1eab51f, 0x78393089, 0x78393089,
+    0x78393089, 0xdb3a0137, 0xdb3a0137, 0x020f82e1, 0x020f82e1, 0x020f82e1, 0xfff9bd98, 0xfff9bd98,
+    0x64eb05be, 0x64eb05be, 0x64eb05be, 0x2e616b34, 0x2e616b34, 0x4cab5a7a, 0x4cab5a7a, 0x4cab5a7a,
+    0x92b310f1, 0x92b310f1, 0xc05ad71b, 0xc05ad71b, 0xc05ad71b, 0x1e97cc0e, 0x1e97cc0e, 0x0ae91014,
+    0x0ae91014, 0x0ae91014, 0xdc514742, 0xdc514742, 0x13fe6ff8, 0x13fe6ff8, 0x13fe6ff8, 0x4bb10101,
+    0x4bb10101, 0x2bdd8fab, 0x2bdd8fab, 0x2bdd8fab, 0x764bb8a9, 0x764bb8a9, 0xdb9af7d3, 0xdb9af7d3,
+    0xdb9af7d3, 0xb5c2b184, 0xb5c2b184, 0xcaf94bca, 0xcaf94bca, 0xcaf94bca, 0x68a7759b, 0x68a7759b,
+    0x7be37275, 0x7be37275, 0x7be37275, 0xdd24d116, 0xdd24d116, 0x357f3d9c, 0x357f3d9c, 0x357f3d9c,
+    0x542e1b3b, 0x542e1b3b, 0x7a267015, 0x7a267015, 0x7a267015, 0x916b50e3, 0x916b50e3, 0x63de8cbd,
+    0x63de8cbd, 0x63de8cbd, 0x0ffc3b64, 0x0ffc3b64, 0x2d9c39aa, 0x2d9c39aa, 0x2d9c39aa, 0x81070a70,
+    0x81070a70, 0xb60c9116, 0xb60c9116, 0xb60c9116, 0xcf44f49d, 0xcf44f49d, 0xd15dc0c7, 0xd15dc0c7,
+    0xd15dc0c7, 0x16bd0b45, 0x16bd0b45, 0x18e8ee4f, 0x18e8ee4f, 0x18e8ee4f, 0x8f1efbc1, 0x8f1efbc1,
+    0xff43006b, 0xff43006b, 0xff43006b, 0x87ddede2, 0x87ddede2, 0x8f73c918, 0x8f73c918, 0x8f73c918,
+    0xeb82614a, 0xeb82614a, 0xaa4ed960, 0xaa4ed960, 0xaa4ed960, 0x012b837f, 0x012b837f, 0xd02257e9,
+    0xd02257e9, 0xd02257e9, 0x8822dd10, 0x8822dd10, 0x41a4b236, 0x41a4b236, 0x41a4b236, 0xbcab01c1,
+    0xbcab01c1, 0x2ccf066b, 0x2ccf066b, 0x2ccf066b, 0x1008c1ac, 0x1008c1ac, 0x3df9f912, 0x3df9f912,
+    0x3df9f912, 0x75ab5e74, 0x75ab5e74, 0xe77e6cba, 0xe77e6cba, 0xe77e6cba, 0x8a55bda3, 0x8a55bda3,
+    0x9344cf7d, 0x9344cf7d, 0x9344cf7d, 0xe46803c7, 0xe46803c7, 0xc6f7abf1, 0xc6f7abf1, 0xc6f7abf1,
+    0x88e5497a, 0x88e5497a, 0xcac2f410, 0xcac2f410, 0xcac2f410, 0xc09b6751, 0xc09b6751, 0x36d25dfb,
+    0x36d25dfb, 0x36d25dfb, 0xf0b9c63d, 0xf0b9c63d, 0x9ae060e7, 0x9ae060e7, 0x9ae060e7, 0xfc3c5e9e,
+    0xfc3c5e9e, 0x2d037a24, 0x2d037a24, 0x2d037a24, 0x7da17196, 0x7da17196, 0x9eb7f01c, 0x9eb7f01c,
+    0x9eb7f01c, 0xa7c5e78b, 0xa7c5e78b, 0x10a483e5, 0x10a483e5, 0x10a483e5, 0xa6ac1da0, 0xa6ac1da0,
+    0xbfdb7c46, 0xbfdb7c46, 0xbfdb7c46, 0xb70d06a9, 0xb70d06a9, 0x1c5c45d3, 0x1c5c45d3, 0x1c5c45d3,
+    0xa1ce7914, 0xa1ce7914, 0x8af504da, 0x8af504da, 0x8af504da, 0xaa20123c, 0xaa20123c, 0x7d271422,
+    0x7d271422, 0x7d271422, 0x1e61d1eb, 0x1e61d1eb, 0xb2dbc8c5, 0xb2dbc8c5, 0xb2dbc8c5, 0x38b233ef,
+    0x38b233ef, 0xe24490d9, 0xe24490d9, 0xe24490d9, 0x4454c8e2, 0x4454c8e2, 0x4beaa418, 0x4beaa418,
+    0x4beaa418, 0xeb6b5a09, 0xeb6b5a09, 0x943420b3, 0x943420b3, 0x943420b3, 0xd461bcd5, 0xd461bcd5,
+    0xd07ff0df, 0xd07ff0df, 0xd07ff0df, 0x4ffddb96, 0x4ffddb96, 0x71145a1c, 0x71145a1c, 0x71145a1c,
+    0xd240b4ee, 0xd240b4ee, 0xce19be74, 0xce19be74, 0xce19be74, 0x65bcb583, 0x65bcb583, 0x6da7545d,
+    0x6da7545d, 0x6da7545d, 0x9bf71398, 0x9bf71398, 0x00e85bbe, 0x00e85bbe, 0x00e85bbe, 0x1ca408c1,
+    0x1ca408c1, 0x8cc80d6b, 0x8cc80d6b, 0x8cc80d6b, 0x7001c8ac, 0x7001c8ac, 0x9df30012, 0x9df30012,
+    0x9df30012, 0xd5a46574, 0xd5a46574, 0x477773ba, 0x477773ba, 0x477773ba, 0xea4ec4a3, 0xea4ec4a3,
+    0xf33dd67d, 0xf33dd67d, 0xf33dd67d, 0x44610ac7, 0x44610ac7, 0x26f0b2f1, 0x26f0b2f1, 0x26f0b2f1,
+    0xe8de507a, 0xe8de507a, 0x2abbfb10, 0x2abbfb10, 0x2abbfb10, 0x25b0c100, 0x25b0c100, 0x60019626,
+    0x60019626, 0x60019626, 0x67f128f4, 0x67f128f4, 0x1108253a, 0x1108253a, 0x1108253a, 0x7edb31d3,
+    0x7edb31d3, 0xa7a8c52d, 0xa7a8c52d, 0xa7a8c52d, 0x6d2f542b, 0x6d2f542b, 0x2d9d3505, 0x2d9d3505,
+    0x2d9d3505, 0x2b1e5ba6, 0x2b1e5ba6, 0x5af25d2c, 0x5af25d2c, 0x5af25d2c, 0xfab61afd, 0xfab61afd,
+    0xa7e5eda7, 0xa7e5eda7, 0xa7e5eda7, 0x6e39ae68, 0x6e39ae68, 0xf119d88e, 0xf119d88e, 0xf119d88e,
+    0xf179968d, 0xf179968d, 0x0486a8b7, 0x0486a8b7, 0x0486a8b7, 0xf2b69285, 0xf2b69285, 0xda5a558f,
+    0xda5a558f, 0xda5a558f, 0x6478cba6, 0x6478cba6, 0x944ccd2c, 0x944ccd2c, 0x944ccd2c, 0x6bcd4cc2,
+    0x6bcd4cc2, 0xe0654378, 0xe0654378, 0xe0654378, 0xa24d857f, 0xa24d857f, 0x714459e9, 0x714459e9,
+    0x714459e9, 0xf3aed100, 0xf3aed100, 0x2dffa626, 0x2dffa626, 0x2dffa626, 0x35ef38f4, 0x35ef38f4,
+    0xdf06353a, 0xdf06353a, 0xdf06353a, 0x4cd941d3, 0x4cd941d3, 0x75a6d52d, 0x75a6d52d, 0x75a6d52d,
+    0x3b2d642b, 0x3b2d642b, 0xfb9b4505, 0xfb9b4505, 0xfb9b4505, 0xf91c6ba6, 0xf91c6ba6, 0x28f06d2c,
+    0x28f06d2c, 0x28f06d2c, 0x53a6d37d, 0x53a6d37d, 0x40df6a27, 0x40df6a27, 0x40df6a27, 0x3c37be68,
+    0x3c37be68, 0xbf17e88e, 0xbf17e88e, 0xbf17e88e, 0xbf77a68d, 0xbf77a68d, 0xd284b8b7, 0xd284b8b7,
+    0xd284b8b7, 0xc0b4a285, 0xc0b4a285, 0xa858658f, 0xa858658f, 0xa858658f, 0x3276dba6, 0x3276dba6,
+    0x624add2c, 0x624add2c, 0x624add2c, 0x39cb5cc2, 0x39cb5cc2, 0xae635378, 0xae635378, 0xae635378,
+    0x704b957f, 0x704b957f, 0x3f4269e9, 0x3f4269e9, 0x3f4269e9, 0x2ac76759, 0x2ac76759, 0x4dc7f883,
+    0x4dc7f883, 0x4dc7f883, 0x37e57fa5, 0x37e57fa5, 0x8bf8772f, 0x8bf8772f, 0x8bf8772f, 0x200259c6,
+    0x200259c6, 0xcc3f884c, 0xcc3f884c, 0xcc3f884c, 0x57fbbc1e, 0x57fbbc1e, 0x8f644fa4, 0x8f644fa4,
+    0x8f644fa4, 0x2885b0d3, 0x2885b0d3, 0x5153442d, 0x5153442d, 0x5153442d, 0xc2cdcf28, 0xc2cdcf28,
+    0x6ab59d4e, 0x6ab59d4e, 0x6ab59d4e, 0x999b0c91, 0x999b0c91, 0x0dd2873b, 0x0dd2873b, 0x0dd2873b,
+    0x8a7ef85c, 0x8a7ef85c, 0x0a6deec2, 0x0a6deec2, 0x0a6deec2, 0xce4f8324, 0xce4f8324, 0x20ede86a,
+    0x20ede86a, 0x20ede86a, 0x836fed73, 0x836fed73, 0xfdb04c4d, 0xfdb04c4d, 0xfdb04c4d, 0x78546e97,
+    0x78546e97, 0x5e2d3141, 0x5e2d3141, 0x5e2d3141, 0x9d8b632a, 0x9d8b632a, 0xe390b740, 0xe390b740,
+    0xe390b740, 0x38394091, 0x38394091, 0xac70bb3b, 0xac70bb3b, 0xac70bb3b, 0x8456337d, 0x8456337d,
+    0x718eca27, 0x718eca27, 0x718eca27, 0x5f67045e, 0x5f67045e, 0x94fc9be4, 0x94fc9be4, 0x94fc9be4,
+    0xa7384456, 0xa7384456, 0x73f1bedc, 0x73f1bedc, 0x73f1bedc, 0xfd8ed5cb, 0xfd8ed5cb, 0x56740125,
+    0x56740125, 0x56740125, 0xa48c4980, 0xa48c4980, 0x22c054a6, 0x22c054a6, 0x22c054a6, 0x9feb0de9,
+    0x9feb0de9, 0x2e042d13, 0x2e042d13, 0x2e042d13, 0xb0ae17d4, 0xb0ae17d4, 0x7b056d9a, 0x7b056d9a,
+    0x7b056d9a, 0x75dd73fc, 0x75dd73fc, 0x096059e2, 0x096059e2, 0x096059e2, 0x3a8ef02b, 0x3a8ef02b,
+    0xfafcd105, 0xfafcd105, 0xfafcd105, 0x7b8a302f, 0x7b8a302f, 0x7a91e719, 0x7a91e719, 0x7a91e719,
+    0x0b09aaa2, 0x0b09aaa2, 0x4a022dd8, 0x4a022dd8, 0x4a022dd8, 0xf9d9c29f, 0xf9d9c29f, 0x99634809,
+    0x99634809, 0x99634809, 0x2e893a1b, 0x2e893a1b, 0x81cdfaf5, 0x81cdfaf5, 0x81cdfaf5, 0x7d09bb0c,
+    0x7d09bb0c, 0x4c4f9cf2, 0x4c4f9cf2, 0x4c4f9cf2, 0x0fe3cee4, 0x0fe3cee4, 0xf63fdf2a, 0xf63fdf2a,
+    0xf63fdf2a, 0x5d37ee59, 0x5d37ee59, 0x80387f83, 0x80387f83, 0x80387f83, 0xc3fa685e, 0xc3fa685e,
+    0xf98fffe4, 0xf98fffe4, 0xf98fffe4, 0xd1703027, 0xd1703027, 0x2905d251, 0x2905d251, 0x2905d251,
+    0x36de5d72, 0x36de5d72, 0x8c69bf28, 0x8c69bf28, 0x8c69bf28, 0x5d4878ea, 0x5d4878ea, 0x3fc6a900,
+    0x3fc6a900, 0x3fc6a900, 0x6026a789, 0x6026a789, 0xda347233, 0xda347233, 0xda347233, 0xaa8f268d,
+    0xaa8f268d, 0xbd9c38b7, 0xbd9c38b7, 0xbd9c38b7, 0xec3198a0, 0xec3198a0, 0x0560f746, 0x0560f746,
+    0x0560f746, 0x9d3145a8, 0x9d3145a8, 0x3a6cc3ce, 0x3a6cc3ce, 0x3a6cc3ce, 0x89dc585c, 0x89dc585c,
+    0x09cb4ec2, 0x09cb4ec2, 0x09cb4ec2, 0x51d45f7b, 0x51d45f7b, 0x8d365055, 0x8d365055, 0x8d365055,
+    0xb1635b13, 0xb1635b13, 0xbf7de86d, 0xbf7de86d, 0xbf7de86d, 0x0611a20e, 0x0611a20e, 0xf262e614,
+    0xf262e614, 0xf262e614, 0x4c676ea5, 0x4c676ea5, 0xa07a662f, 0xa07a662f, 0xa07a662f, 0x28f87dd0,
+    0x28f87dd0, 0xccb088f6, 0xccb088f6, 0xccb088f6, 0x8d281c15, 0x8d281c15, 0x69dfbd1f, 0x69dfbd1f,
+    0x69dfbd1f, 0xe7c1984d, 0xe7c1984d, 0x15613d77, 0x15613d77, 0x15613d77, 0x508ecfce, 0x508ecfce,
+    0xfa8384d4, 0xfa8384d4, 0xfa8384d4, 0x114e50ca, 0x114e50ca, 0x98d6dae0, 0x98d6dae0, 0x98d6dae0,
+    0x4a446067, 0x4a446067, 0xe0a9af91, 0xe0a9af91, 0xe0a9af91, 0xcba06b77, 0xcba06b77, 0x79df7b21,
+    0x79df7b21, 0x79df7b21, 0xf6612c53, 0xf6612c53, 0x7a709dad, 0x7a709dad, 0x7a709dad, 0xfbe47444,
+    0xfbe47444, 0x6315008a, 0x6315008a, 0x6315008a, 0xb0cc377c, 0xb0cc377c, 0x624f3d62, 0x624f3d62,
+    0x624f3d62, 0x870822f1, 0x870822f1, 0xb4afe91b, 0xb4afe91b, 0xb4afe91b, 0x9758e146, 0x9758e146,
+    0xfba801cc, 0xfba801cc, 0xfba801cc, 0xdb4c2ddf, 0xdb4c2ddf, 0xcba15a49, 0xcba15a49, 0xcba15a49,
+    0x95a98aea, 0x95a98aea, 0x7827bb00, 0x7827bb00, 0x7827bb00, 0x9bc83382, 0x9bc83382, 0xb4095238,
+    0xb4095238, 0xb4095238, 0xca5db7a1, 0xca5db7a1, 0x372816cb, 0x372816cb, 0x372816cb, 0xfb1350a5,
+    0xfb1350a5, 0x4f26482f, 0x4f26482f, 0x4f26482f, 0x81c17018, 0x81c17018, 0x82ac043e, 0x82ac043e,
+    0x82ac043e, 0xf94b84a2, 0xf94b84a2, 0x384407d8, 0x384407d8, 0x384407d8, 0x1b7f9086, 0x1b7f9086,
+    0xb9b78d0c, 0xb9b78d0c, 0xb9b78d0c, 0x6a31fda5, 0x6a31fda5, 0xbe44f52f, 0xbe44f52f, 0xbe44f52f,
+    0x253e28ad, 0x253e28ad, 0x2a7ed1d7, 0x2a7ed1d7, 0x2a7ed1d7, 0xd7a967c8, 0xd7a967c8, 0x52d51aee,
+    0x52d51aee, 0x52d51aee, 0x7b5797ef, 0x7b5797ef, 0x24e9f4d9, 0x24e9f4d9, 0x24e9f4d9, 0xee19aaba,
+    0xee19aaba, 0x6a97b450, 0x6a97b450, 0x6a97b450, 0x1922cf5f, 0x1922cf5f, 0x17febdc9, 0x17febdc9,
+    0x17febdc9, 0x6b926977, 0x6b926977, 0x19d17921, 0x19d17921, 0x19d17921, 0x82593e58, 0x82593e58,
+    0x1825e77e, 0x1825e77e, 0x1825e77e, 0x117267f4, 0x117267f4, 0xba89643a, 0xba89643a, 0xba89643a,
+    0xb31ba531, 0xb31ba531, 0x9356195b, 0x9356195b, 0x9356195b, 0x06d7504e, 0x06d7504e, 0x2551b154,
+    0x2551b154, 0x2551b154, 0xf31eff82, 0xf31eff82, 0x0b601e38, 0x0b601e38, 0x0b601e38, 0xe20744c1,
+    0xe20744c1, 0x522b496b, 0x522b496b, 0x522b496b, 0x5a19be69, 0x5a19be69, 0x4374bb93, 0x4374bb93,
+    0x4374bb93, 0x0b0793c4, 0x0b0793c4, 0xaf22ee0a, 0xaf22ee0a, 0xaf22ee0a, 0x999fbf5b, 0x999fbf5b
+};
+
+// ─── Helpers ─────────────────────────────────────────────────
+static uint32_t fnv1a(const uint8_t* data, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) h = (h ^ data[i]) * 16777619u;
+    return h;
+}
+
+// The lit words of a face's phrase, in reading order
+static std::string phrase(int face, int hour24, int minute) {
+    const Face& f = faces[face];
+    uint64_t    w = timeWords(f, hour24, minute);
+    std::string out;
+    for (int r = 0; r < FACE_ROWS; r++)
+        for (int c = 0; c < FACE_COLS; c++)
+            for (int i = 0; i < f.wordCount; i++) {
+                if (!(w >> i & 1) || f.words[i].row != r || f.words[i].col != c) continue;
+                if (!out.empty()) out += ' ';
+                out += f.words[i].text;
+            }
+    return out;
+}
+
+struct Step {
+    int         hour, minute;
+    const char* text;
+};
+
+// Every minute of a step reads the same as its first one.
+static void checkSteps(int face, const Step* steps, int count) {
+    char label[32];
+    for (int i = 0; i < count; i++) {
+        const Step& s = steps[i];
+        for (int m = s.minute; m < s.minute + 5 && m < 60; m++) {
+            snprintf(label, sizeof(label), "%s %02d:%02d", faces[face].name, s.hour, m);
+            TEST_ASSERT_EQUAL_STRING_MESSAGE(s.text, phrase(face, s.hour, m).c_str(), label);
+        }
+    }
+}
+
+// ─── Tests ──────────────────────────────────────────────────
+void setUp() {}
+void tearDown() {}
+
+static void test_en_almost_matches_old_light_time() {
+    char label[16];
+    for (int m = 0; m < 24 * 60; m++) {
+        lightTime(m / 60, m % 60);
+        snprintf(label, sizeof(label), "%02d:%02d", m / 60, m % 60);
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE(oldLightTime[m], fnv1a((const uint8_t*)leds, sizeof(leds)), label);
+    }
+}
+
+static void test_en_five_phrases() {
+    static const Step steps[] = {
+        { 14,  0, "IT IS TWO O'CLOCK PM" },
+        { 14,  5, "IT IS FIVE MINUTES PAST TWO PM" },
+        { 14, 10, "IT IS TEN MINUTES PAST TWO PM" },
+        { 14, 15, "IT IS A QUARTER PAST TWO PM" },
+        { 14, 20, "IT IS TWENTY MINUTES PAST TWO PM" },
+        { 14, 25, "IT IS TWENTY FIVE MINUTES PAST TWO PM" },
+        { 14, 30, "IT IS HALF PAST TWO PM" },
+        { 14, 35, "IT IS TWENTY FIVE MINUTES TO THREE PM" },
+        { 14, 40, "IT IS TWENTY MINUTES TO THREE PM" },
+        { 14, 45, "IT IS A QUARTER TO THREE PM" },
+        { 14, 50, "IT IS TEN MINUTES TO THREE PM" },
+        { 14, 55, "IT IS FIVE MINUTES TO THREE PM" },
+        // AM/PM follows the hour that is named
+        { 11, 55, "IT IS FIVE MINUTES TO TWELVE PM" },
+        { 23, 55, "IT IS FIVE MINUTES TO TWELVE AM" },
+        {  0, 30, "IT IS HALF PAST TWELVE AM" },
+        { 12, 45, "IT IS A QUARTER TO ONE PM" },
+    };
+    checkSteps(FACE_EN_FIVE, steps, sizeof(steps) / sizeof(steps[0]));
+}
+
+static void test_de_phrases() {
+    static const Step steps[] = {
+        { 14,  0, "ES IST ZWEI UHR" },
+        { 14,  5, "ES IST FÜNF NACH ZWEI" },
+        { 14, 10, "ES IST ZEHN NACH ZWEI" },
+        { 14, 15, "ES IST VIERTEL NACH ZWEI" },
+        { 14, 20, "ES IST ZWANZIG NACH ZWEI" },
+        { 14, 25, "ES IST FÜNF VOR HALB DREI" },
+        { 14, 30, "ES IST HALB DREI" },
+        { 14, 35, "ES IST FÜNF NACH HALB DREI" },
+        { 14, 40, "ES IST ZWANZIG VOR DREI" },
+        { 14, 45, "ES IST VIERTEL VOR DREI" },
+        { 14, 50, "ES IST ZEHN VOR DREI" },
+        { 14, 55, "ES IST FÜNF VOR DREI" },
+        // "EIN UHR" on the hour, "EINS" otherwise
+        {  1,  0, "ES IST EIN UHR" },
+        {  1,  5, "ES IST FÜNF NACH EINS" },
+        {  0, 45, "ES IST VIERTEL VOR EINS" },
+        {  0,  0, "ES IST ZWÖLF UHR" },
+        { 23, 30, "ES IST HALB ZWÖLF" },
+    };
+    checkSteps(FACE_DE, steps, sizeof(steps) / sizeof(steps[0]));
+}
+
+int main(int argc, char** argv) {
+    (void)argc; (void)argv;
+    wordclock_init();       // FastLED.clear() in lightTime() clears the registered leds[]
+    UNITY_BEGIN();
+    RUN_TEST(test_en_almost_matches_old_light_time);
+    RUN_TEST(test_en_five_phrases);
+    RUN_TEST(test_de_phrases);
+    return UNITY_END();
+}
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Viewer for word clock LED traces (see src/led_trace.h).
+
+Reads traces from a serial log (the hex blocks between "LEDTRACE <label> <n>"
+and "LEDTRACE END" lines) or from raw .ltr files, and shows what the matrix
+did without having to watch it.
+
+  list     traces found in the input, with frame count and duration
+  timing   per-frame report: gap since the previous show(), show() time,
+           changed LEDs, plus pacing statistics for each trace
+  term     play a trace in the terminal with 24-bit colour
+  gif      write an animated GIF with the recorded frame timing (needs Pillow)
+  extract  save each trace as <label>.ltr
+
+Examples:
+  pio device monitor | tee clock.log
+  tools/led_trace.py timing clock.log
+  tools/led_trace.py term clock.log --trace 07:45 --speed 0.5
+  tools/led_trace.py gif clock.log --trace 2 -o fade.gif --scale 16
+"""
+
+import argparse
+import os
+import re
+import statistics
+import struct
+import sys
+import time
+
+ROWS = 13
+COLS = 13
+HEADER = struct.Struct("<4sHH")
+FRAME = struct.Struct("<IHH")
+ENTRY = struct.Struct("<HBBB")
+FLAG_TRUNCATED = 0x01
+
+
+# ─── parsing ──────────────────────────────────────────────────
+class Trace:
+    def __init__(self, label, data):
+        magic, self.num_leds, self.flags = HEADER.unpack_from(data, 0)
+        if magic != b"LTR1":
+            raise ValueError("%s: not an LED trace" % label)
+        self.label = label
+        off = HEADER.size
+        base = data[off:off + self.num_leds * 3]
+        self.base = [tuple(base[i * 3:i * 3 + 3]) for i in range(self.num_leds)]
+        off += self.num_leds * 3
+        self.frames = []  # (t_us, show_us, [(index, (r, g, b)), ...])
+        while off + FRAME.size <= len(data):
+            t_us, show_us, count = FRAME.unpack_from(data, off)
+            off += FRAME.size
+            changes = []
+            for _ in range(count):
+                i, r, g, b = ENTRY.unpack_from(data, off)
+                off += ENTRY.size
+                changes.append((i, (r, g, b)))
+            self.frames.append((t_us, show_us, changes))
+
+    @property
+    def truncated(self):
+        return bool(self.flags & FLAG_TRUNCATED)
+
+    def states(self):
+        """Yields (t_us, show_us, full LED list) for every frame."""
+        state = list(self.base)
+        for t_us, show_us, changes in self.frames:
+            for i, rgb in changes:
+                state[i] = rgb
+            yield t_us, show_us, state
+
+
+def load(paths):
+    traces = []
+    for path in paths:
+        with open(path, "rb") as f:
+            raw = f.read()
+        if raw[:4] == b"LTR1":
+            traces.append(Trace(os.path.splitext(os.path.basename(path))[0], raw))
+            continue
+        label, hexdata = None, []
+        for line in raw.decode("utf-8", "replace").splitlines():
+            line = line.strip()
+            if line == "LEDTRACE END":
+                if label is not None:
+                    traces.append(Trace(label, bytes.fromhex("".join(hexdata))))
+                label, hexdata = None, []
+            elif line.startswith("LEDTRACE "):
+                label, hexdata = line.split()[1], []
+            elif label is not None and re.fullmatch(r"[0-9a-f]+", line):
+                hexdata.append(line)
+    return traces
+
+
+def select(traces, which):
+    if which is None:
+        return traces
+    if which.isdigit() and int(which) < len(traces):
+        return [traces[int(which)]]
+    picked = [t for t in traces if t.label == which]
+    if not picked:
+        sys.exit("no trace %r (have: %s)" % (which, ", ".join(t.label for t in traces)))
+    return picked
+
+
+# Same wiring as the default WordMatrix in word_clock.h (strip starts bottom
+# left, rows alternate direction); change both together.
+def led_at(row, col):
+    phys = ROWS - 1 - row
+    return phys * COLS + (col if phys % 2 == 0 else COLS - 1 - col)
+
+
+# ─── commands ─────────────────────────────────────────────────
+def cmd_list(args):
+    for n, t in enumerate(select(load(args.input), args.trace)):
+        dur = t.frames[-1][0] / 1000.0 if t.frames else 0
+        print("%3d  %-8s %4d frames %8.1f ms%s" % (n, t.label, len(t.frames), dur,
+                                                   "  [truncated]" if t.truncated else ""))
+
+
+def summary(xs, unit):
+    if not xs:
+        return "-"
+    xs = sorted(xs)
+    p95 = xs[min(len(xs) - 1, int(len(xs) * 0.95))]
+    return "avg %.1f p50 %.1f p95 %.1f max %.1f %s" % (statistics.mean(xs), xs[len(xs) // 2], p95, xs[-1], unit)
+
+
+def cmd_timing(args):
+    for t in select(load(args.input), args.trace):
+        print("trace %s: %d frames%s" % (t.label, len(t.frames), " [truncated]" if t.truncated else ""))
+        gaps, shows, prev = [], [], None
+        for n, (t_us, show_us, changes) in enumerate(t.frames):
+            gap = (t_us - prev) / 1000.0 if prev is not None else 0.0
+            prev = t_us
+            if n:
+                gaps.append(gap)
+            shows.append(show_us / 1000.0)
+            if args.frames:
+                print("  %4d  t %8.2f ms  gap %7.2f ms  show %5.2f ms  %3d changed"
+                      % (n, t_us / 1000.0, gap, show_us / 1000.0, len(changes)))
+        print("  gap   " + summary(gaps, "ms"))
+        print("  show  " + summary(shows, "ms"))
+        if gaps:
+            print("  fps   %.1f (from the average gap)" % (1000.0 / statistics.mean(gaps)))
+            if len(gaps) > 1:
+                print("  jitter %.2f ms (stdev of gaps)" % statistics.stdev(gaps))
+
+
+def cmd_term(args):
+    for t in select(load(args.input), args.trace):
+        prev = None
+        sys.stdout.write("\x1b[2J")
+        for t_us, _, state in t.states():
+            if prev is not None:
+                time.sleep(max(0.0, (t_us - prev) / 1e6 / args.speed))
+            prev = t_us
+            out = ["\x1b[H%s  %.1f ms\n" % (t.label, t_us / 1000.0)]
+            for row in range(ROWS):
+                for col in range(COLS):
+                    r, g, b = state[led_at(row, col)]
+                    out.append("\x1b[48;2;%d;%d;%dm  " % (r, g, b))
+                out.append("\x1b[0m\n")
+            sys.stdout.write("".join(out))
+            sys.stdout.flush()
+
+
+def cmd_gif(args):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("gif needs Pillow: pip install pillow")
+    t = select(load(args.input), args.trace)[0]
+    images, durations, prev = [], [], None
+    for t_us, _, state in t.states():
+        img = Image.new("RGB", (COLS, ROWS))
+        img.putdata([state[led_at(row, col)] for row in range(ROWS) for col in range(COLS)])
+        images.append(img.resize((COLS * args.scale, ROWS * args.scale), Image.NEAREST))
+        if prev is not None:
+            durations.append(max(20, int((t_us - prev) / 1000)))
+        prev = t_us
+    if not images:
+        sys.exit("trace %s has no frames" % t.label)
+    durations.append(1000)  # hold the final frame
+    out = args.output or "%s.gif" % t.label.replace(":", "")
+    images[0].save(out, save_all=True, append_images=images[1:], duration=durations, loop=0)
+    print("wrote %s (%d frames)" % (out, len(images)))
+
+
+def cmd_extract(args):
+    for path in args.input:
+        with open(path, "rb") as f:
+            raw = f.read().decode("utf-8", "replace")
+        for n, m in enumerate(re.finditer(r"LEDTRACE (\S+) \d+\s*\n(.*?)LEDTRACE END", raw, re.S)):
+            data = bytes.fromhex("".join(m.group(2).split()))
+            name = os.path.join(args.dir, "%03d_%s.ltr" % (n, m.group(1).replace(":", "")))
+            with open(name, "wb") as f:
+                f.write(data)
+            print("saved %s (%d B)" % (name, len(data)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+
+    def add(name, func):
+        p = sub.add_parser(name)
+        p.add_argument("input", nargs="+", help="serial log or .ltr file")
+        p.set_defaults(func=func)
+        return p
+
+    add("list", cmd_list).add_argument("--trace", help="label or index")
+
+    p = add("timing", cmd_timing)
+    p.add_argument("--trace", help="label or index")
+    p.add_argument("--frames", action="store_true", help="print every frame, not just the summary")
+
+    p = add("term", cmd_term)
+    p.add_argument("--trace", help="label or index")
+    p.add_argument("--speed", type=float, default=1.0, help="playback speed factor")
+
+    p = add("gif", cmd_gif)
+    p.add_argument("--trace", default="0", help="label or index")
+    p.add_argument("-o", "--output")
+    p.add_argument("--scale", type=int, default=12, help="pixels per LED")
+
+    add("extract", cmd_extract).add_argument("--dir", default=".")
+
+    args = ap.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
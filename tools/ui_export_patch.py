@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""Reapply the firmware's edits to a fresh SquareLine Studio export.
+
+SquareLine regenerates src/ui/ui.c on every export. Its *_Animation()
+functions have to go through src/ui_anim_pool.h: pooled user data, the
+target as the anim var and deduplicated starts. This rewrites them in place
+and is safe to run again on an already patched file.
+
+  tools/ui_export_patch.py            patch src/ui/ui.c
+  tools/ui_export_patch.py --check    exit 1 if it still needs patching
+
+The edits are listed in src/ui/PATCHES.md.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+UI_C = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "ui", "ui.c")
+INCLUDE = '#include "../ui_anim_pool.h"'
+
+
+def patch(src):
+    out = src
+    if INCLUDE not in out:
+        out = out.replace('#include "ui.h"\n', '#include "ui.h"\n' + INCLUDE + "\n", 1)
+    out = out.replace("lv_malloc(sizeof(ui_anim_user_data_t))", "ui_anim_user_data_alloc()")
+    out = out.replace("_ui_anim_callback_free_user_data)", "ui_anim_free_user_data)")
+    out = re.sub(r"= lv_anim_start\(&", "= ui_anim_start(&", out)
+    # The target as the anim var, right after lv_anim_init()
+    out = re.sub(r"^(\s*)lv_anim_init\(&(\w+)\);\n(?!\s*lv_anim_set_var\()",
+                 r"\1lv_anim_init(&\2);\n\1lv_anim_set_var(&\2, TargetObject);\n", out, flags=re.M)
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--check", action="store_true", help="only report whether ui.c needs patching")
+    ap.add_argument("file", nargs="?", default=UI_C)
+    args = ap.parse_args()
+
+    with open(args.file, encoding="utf-8") as f:
+        src = f.read()
+    if "_Animation(lv_obj_t * TargetObject" not in src:
+        sys.exit("%s: no SquareLine animations found" % args.file)
+    out = patch(src)
+    if out == src:
+        print("%s: already patched" % args.file)
+        return
+    if args.check:
+        print("%s: needs patching, run %s" % (args.file, sys.argv[0]))
+        sys.exit(1)
+    with open(args.file, "w", encoding="utf-8") as f:
+        f.write(out)
+    print("%s: patched" % args.file)
+
+
+if __name__ == "__main__":
+    main()
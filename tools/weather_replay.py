@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Local stand-in for the weather service.
+
+Replays recorded responses so the clock's weather client can be exercised and
+timed without the real API (set WEATHER_BASE_URL in credentials.h to this
+server's address), and measures fetch latency and parse cost from Linux.
+
+  serve   replay tools/replay/<endpoint>_*.json in order, with optional
+          latency and fault injection
+  record  save live responses from api.weatherapi.com for later replay
+  bench   hit a server N times and report latency, size and JSON parse time
+          (Python's; the firmware parser itself is timed over the same
+          recordings by: pio test -e native -f test_weather_parse -v)
+
+Examples:
+  tools/weather_replay.py serve --port 8080 --latency 300 --fail-rate 0.1
+  tools/weather_replay.py record --key $KEY --q "Ambala,Haryana,India"
+  tools/weather_replay.py bench --url "http://localhost:8080/v1/current.json?key=x&q=x&aqi=yes" -n 50
+"""
+
+import argparse
+import glob
+import json
+import os
+import random
+import statistics
+import sys
+import time
+import urllib.parse
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_DIR = os.path.join(HERE, "replay")
+LIVE_BASE = "http://api.weatherapi.com"
+
+
+# ─── serve ────────────────────────────────────────────────────
+class Replay:
+    def __init__(self, directory, loop, shift_clock):
+        self.directory = directory
+        self.loop = loop
+        self.shift_clock = shift_clock
+        self.cursor = {}
+
+    def next_body(self, endpoint):
+        files = sorted(glob.glob(os.path.join(self.directory, endpoint + "_*.json")))
+        if not files:
+            return None
+        i = self.cursor.get(endpoint, 0)
+        self.cursor[endpoint] = i + 1
+        i = i % len(files) if self.loop else min(i, len(files) - 1)
+        with open(files[i], "rb") as f:
+            body = f.read()
+        if self.shift_clock:
+            body = self.rebase(body)
+        return body
+
+    def rebase(self, body):
+        # Move every *_epoch so the recording's server time becomes "now",
+        # keeping the gaps between fields (and so the client's schedule) intact.
+        doc = json.loads(body)
+        server = doc.get("location", {}).get("localtime_epoch")
+        if not server:
+            return body
+        delta = int(time.time()) - server
+
+        def walk(node):
+            if isinstance(node, dict):
+                for k, v in node.items():
+                    if k.endswith("_epoch") and isinstance(v, int):
+                        node[k] = v + delta
+                    else:
+                        walk(v)
+            elif isinstance(node, list):
+                for v in node:
+                    walk(v)
+
+        walk(doc)
+        return json.dumps(doc, separators=(",", ":")).encode()
+
+
+def make_handler(replay, args):
+    class Handler(BaseHTTPRequestHandler):
+        def do_GET(self):
+            path = urllib.parse.urlparse(self.path).path
+            endpoint = os.path.splitext(os.path.basename(path))[0]
+
+            delay = args.latency + random.uniform(0, args.jitter)
+            if delay:
+                time.sleep(delay / 1000.0)
+
+            if random.random() < args.fail_rate:
+                if args.fail_mode == "drop":
+                    self.close_connection = True
+                    return
+                if args.fail_mode == "status":
+                    return self.reply(500, b'{"error":{"code":9999,"message":"Internal application error."}}')
+
+            body = replay.next_body(endpoint)
+            if body is None:
+                return self.reply(400, b'{"error":{"code":1005,"message":"API request url is invalid."}}')
+            if random.random() < args.fail_rate and args.fail_mode == "truncate":
+                body = body[: len(body) // 2]
+            self.reply(200, body)
+
+        def reply(self, status, body):
+            self.send_response(status)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def log_message(self, fmt, *a):
+            sys.stderr.write("%s %s\n" % (self.address_string(), fmt % a))
+
+    return Handler
+
+
+def cmd_serve(args):
+    replay = Replay(args.dir, not args.hold, args.shift_clock)
+    server = ThreadingHTTPServer((args.host, args.port), make_handler(replay, args))
+    print("replaying %s on http://%s:%d" % (args.dir, args.host, args.port))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+# ─── record ───────────────────────────────────────────────────
+def cmd_record(args):
+    os.makedirs(args.dir, exist_ok=True)
+    params = {"key": args.key, "q": args.q, "aqi": "yes"}
+    if args.endpoint == "forecast":
+        params.update(days=args.days, aqi="no", alerts="no")
+    query = urllib.parse.urlencode(params)
+    for n in range(args.count):
+        url = "%s/v1/%s.json?%s" % (LIVE_BASE, args.endpoint, query)
+        with urllib.request.urlopen(url, timeout=10) as r:
+            body = r.read()
+        existing = glob.glob(os.path.join(args.dir, args.endpoint + "_*.json"))
+        name = os.path.join(args.dir, "%s_%04d.json" % (args.endpoint, len(existing) + 1))
+        with open(name, "wb") as f:
+            f.write(body)
+        print("saved %s (%d B)" % (name, len(body)))
+        if n + 1 < args.count:
+            time.sleep(args.every)
+
+
+# ─── bench ────────────────────────────────────────────────────
+def cmd_bench(args):
+    fetch_ms, parse_us, sizes, errors = [], [], [], {}
+    for _ in range(args.n):
+        t0 = time.perf_counter()
+        try:
+            with urllib.request.urlopen(args.url, timeout=args.timeout) as r:
+                body = r.read()
+        except Exception as e:  # noqa: BLE001 - every failure class is counted
+            key = type(e).__name__
+            errors[key] = errors.get(key, 0) + 1
+            continue
+        fetch_ms.append((time.perf_counter() - t0) * 1000)
+        sizes.append(len(body))
+        t1 = time.perf_counter()
+        try:
+            json.loads(body)
+        except ValueError:
+            errors["parse"] = errors.get("parse", 0) + 1
+            continue
+        parse_us.append((time.perf_counter() - t1) * 1e6)
+
+    def summary(xs, unit):
+        if not xs:
+            return "-"
+        xs = sorted(xs)
+        p95 = xs[min(len(xs) - 1, int(len(xs) * 0.95))]
+        return "avg %.1f p50 %.1f p95 %.1f max %.1f %s" % (statistics.mean(xs), xs[len(xs) // 2], p95, xs[-1], unit)
+
+    print("requests  %d ok, %s" % (len(fetch_ms), errors or "no errors"))
+    print("fetch     " + summary(fetch_ms, "ms"))
+    print("parse     " + summary(parse_us, "us (Python json.loads, not the firmware parser)"))
+    print("size      " + summary(sizes, "B"))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+
+    s = sub.add_parser("serve")
+    s.add_argument("--host", default="0.0.0.0")
+    s.add_argument("--port", type=int, default=8080)
+    s.add_argument("--dir", default=DEFAULT_DIR)
+    s.add_argument("--hold", action="store_true", help="keep serving the last recording instead of looping")
+    s.add_argument("--shift-clock", action="store_true", help="rebase *_epoch fields to the current time")
+    s.add_argument("--latency", type=float, default=0, help="added delay per request, ms")
+    s.add_argument("--jitter", type=float, default=0, help="extra random delay up to this many ms")
+    s.add_argument("--fail-rate", type=float, default=0)
+    s.add_argument("--fail-mode", choices=("status", "drop", "truncate"), default="status")
+    s.set_defaults(func=cmd_serve)
+
+    r = sub.add_parser("record")
+    r.add_argument("--key", required=True)
+    r.add_argument("--q", required=True)
+    r.add_argument("--endpoint", default="current")
+    r.add_argument("--days", type=int, default=3, help="forecast endpoint only")
+    r.add_argument("--dir", default=DEFAULT_DIR)
+    r.add_argument("--count", type=int, default=1)
+    r.add_argument("--every", type=float, default=900, help="seconds between recordings")
+    r.set_defaults(func=cmd_record)
+
+    b = sub.add_parser("bench")
+    b.add_argument("--url", required=True)
+    b.add_argument("-n", type=int, default=20)
+    b.add_argument("--timeout", type=float, default=5)
+    b.set_defaults(func=cmd_bench)
+
+    args = ap.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()